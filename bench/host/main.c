@@ -0,0 +1,22 @@
+/**
+ * Runs the FreeRTOS primitive benchmarks once on the POSIX port and prints the table.
+ */
+
+#include <FreeRTOS.h>
+#include <stdlib.h>
+#include <task.h>
+
+#include "rtos_bench.h"
+
+#define BENCH_PRIORITY (configMAX_PRIORITIES - 2)  // Above every benchmark task, the POSIX config has no timer task
+
+static void bench_task(void *pvParameters) {
+    rtos_bench_run_all(RTOS_BENCH_MAX_SAMPLES, BENCH_PRIORITY);
+    exit(0);
+}
+
+int main(void) {
+    xTaskCreate(bench_task, "BENCH", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY, NULL);
+    vTaskStartScheduler();
+    return 1;  // the scheduler could not start
+}
@@ -0,0 +1,44 @@
+/**
+ * Benchmarks of the FreeRTOS primitives, a firmware of its own.
+ * Every BENCH_PERIOD_MS the whole suite runs (see local-libs/rtos_bench) and a table
+ * of latencies and throughputs is printed over USB.
+ */
+
+#include <FreeRTOS.h>
+#include <pico/stdlib.h>
+#include <task.h>
+
+#include "rtos_bench.h"
+
+#define BENCH_PRIORITY (configMAX_PRIORITIES - 2)  // Above every benchmark task, below the timer task
+#define BENCH_PERIOD_MS 10000                      // Time between two runs of the suite
+
+static void bench_task(void *pvParameters) {
+    vTaskDelay(pdMS_TO_TICKS(2000));  // Give the USB terminal time to connect
+
+    while (true) {
+        rtos_bench_run_all(RTOS_BENCH_MAX_SAMPLES, BENCH_PRIORITY);
+        vTaskDelay(pdMS_TO_TICKS(BENCH_PERIOD_MS));
+    }
+}
+
+int main() {
+    stdio_init_all();  // Initialize
+
+    xTaskCreate(
+        bench_task,      // Task to be run
+        "BENCH",         // Name of the Task for debugging and managing its Task Handle
+        1024,            // Stack depth to be allocated for use with task's stack (see docs)
+        NULL,            // Arguments needed by the Task (NULL because we don't have any)
+        BENCH_PRIORITY,  // Task Priority
+        NULL             // Task Handle if available for managing the task
+    );
+
+    vTaskStartScheduler();
+
+    while (true) {
+        // Your program should never get here
+    };
+
+    return 0;
+}
@@ -63,7 +63,8 @@
 #define configUSE_NEWLIB_REENTRANT              0
 // todo need this for lwip FreeRTOS sys_arch to compile
 #define configENABLE_BACKWARD_COMPATIBILITY     1
-#define configNUM_THREAD_LOCAL_STORAGE_POINTERS 5
+#define configNUM_THREAD_LOCAL_STORAGE_POINTERS 5   // slot 4 is used by cpu_stats (core and migrations of each task)
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES   3   // slot 1 is used by the i2c_bus driver, slot 2 by task_signal
 
 /* System */
 #define configSTACK_DEPTH_TYPE                  uint32_t
@@ -81,9 +82,19 @@
 #define configUSE_DAEMON_TASK_STARTUP_HOOK      0
 
 /* Run time and task stats gathering related definitions. */
-#define configGENERATE_RUN_TIME_STATS           0
+#define configGENERATE_RUN_TIME_STATS           1   // microseconds, reported by local-libs/cpu_stats
 #define configUSE_TRACE_FACILITY                1
-#define configUSE_STATS_FORMATTING_FUNCTIONS    0
+#define configUSE_STATS_FORMATTING_FUNCTIONS    0   // cpu_stats prints its own, without vTaskGetRunTimeStats' buffers
+
+#ifndef __ASSEMBLER__
+#include <stdint.h>
+uint32_t cpu_stats_time_us(void);
+void cpu_stats_switched_in(void);
+#endif
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()    // the RP2040 timer runs from boot
+#define portGET_RUN_TIME_COUNTER_VALUE()        cpu_stats_time_us()
+// per core idle / busy time, and the switch event when TRACE_RECORDER is set (see below)
+#define traceTASK_SWITCHED_IN()                 do { cpu_stats_switched_in(); TRACE_REC_SWITCHED_IN(); } while (0)
 
 /* Co-routine related definitions. */
 #define configUSE_CO_ROUTINES                   0
@@ -138,6 +149,16 @@ to exclude the API function. */
 #define INCLUDE_xQueueGetMutexHolder            1
 
 /* A header file that defines trace macro can be included here. */
+#ifndef TRACE_RECORDER
+#define TRACE_RECORDER                          0   // 1 records task switches, queues and interrupts, see local-libs/trace_rec
+#endif
+#if TRACE_RECORDER && !defined(__ASSEMBLER__)
+#include "trace_rec_hooks.h"
+#else
+#define TRACE_REC_SWITCHED_IN()
+#define traceISR_ENTER()                        // called by instrumented interrupt handlers either way
+#define traceISR_EXIT()
+#endif
 
 #endif /* FREERTOS_CONFIG_H */
 
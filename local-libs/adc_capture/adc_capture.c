@@ -0,0 +1,94 @@
+#include "adc_capture.h"
+
+#include <stddef.h>
+
+bool adc_capture_init(adc_capture_t *cap, const adc_capture_source_t *source, void *ctx,
+                      const volatile uint16_t *ring, uint32_t ring_len, uint8_t channels, uint8_t oversample_bits) {
+    if (oversample_bits > ADC_CAPTURE_MAX_OVERSAMPLE_BITS || ring_len == 0 || (ring_len & (ring_len - 1)) != 0) {
+        return false;
+    }
+    if (channels == 0 || channels > ADC_CAPTURE_MAX_CHANNELS) {
+        return false;
+    }
+    if (ring_len < 2 * ((uint32_t)channels << (2 * oversample_bits))) {
+        return false;
+    }
+
+    cap->source = source;
+    cap->ctx = ctx;
+    cap->ring = ring;
+    cap->ring_len = ring_len;
+    cap->channels = channels;
+    cap->oversample_bits = oversample_bits;
+    cap->tail = source->head(ctx);
+    cap->overruns = 0;
+    return true;
+}
+
+// Samples written but not read yet, in whole channel cycles
+static uint32_t pending_samples(const adc_capture_t *cap, uint32_t head) {
+    int32_t pending = (int32_t)(head - cap->tail);
+    if (pending < 0) {
+        return 0;  // head is read without locking and may briefly lag behind
+    }
+    return (uint32_t)pending - (uint32_t)pending % cap->channels;
+}
+
+// Same, skipping ahead if the source is about to lap us
+static uint32_t pending_checked(adc_capture_t *cap, uint32_t head) {
+    uint32_t pending = pending_samples(cap, head);
+    uint32_t block = adc_capture_block_len(cap);
+    if (pending > cap->ring_len / 2) {
+        uint32_t keep = (cap->ring_len / 2) / block * block;
+        cap->overruns += (pending - keep) / block;
+        cap->tail += pending - keep;
+        return keep;
+    }
+    return pending;
+}
+
+static void sum_block(const adc_capture_t *cap, uint32_t start, uint32_t *out) {
+    uint32_t mask = cap->ring_len - 1;
+    uint32_t block = adc_capture_block_len(cap);
+    uint8_t k = cap->oversample_bits;
+
+    for (uint8_t ch = 0; ch < cap->channels; ch++) {
+        uint32_t sum = 0;
+        for (uint32_t i = ch; i < block; i += cap->channels) {
+            sum += cap->ring[(start + i) & mask];
+        }
+        out[ch] = k == 0 ? sum : (sum + (1u << (k - 1))) >> k;  // 4^k samples >> k leaves k extra bits
+    }
+}
+
+uint32_t adc_capture_available(adc_capture_t *cap) {
+    return pending_checked(cap, cap->source->head(cap->ctx)) / adc_capture_block_len(cap);
+}
+
+bool adc_capture_read(adc_capture_t *cap, uint32_t *out) {
+    uint32_t block = adc_capture_block_len(cap);
+    if (pending_checked(cap, cap->source->head(cap->ctx)) < block) {
+        return false;
+    }
+
+    sum_block(cap, cap->tail, out);
+    cap->tail += block;
+    return true;
+}
+
+bool adc_capture_read_latest(adc_capture_t *cap, uint32_t *out) {
+    uint32_t block = adc_capture_block_len(cap);
+    uint32_t pending = pending_samples(cap, cap->source->head(cap->ctx));
+    if (pending < block) {
+        return false;
+    }
+
+    uint32_t end = cap->tail + pending;
+    sum_block(cap, end - block, out);  // older samples are dropped on purpose, not an overrun
+    cap->tail = end;
+    return true;
+}
+
+void adc_capture_resync(adc_capture_t *cap) {
+    cap->tail = cap->source->head(cap->ctx);
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+/**
+ * Free-running ADC capture with oversampling.
+ *
+ * A source (DMA on the device, a stand-in on the host) writes raw 12-bit samples
+ * into a power of two ring buffer and reports how many it has written in total.
+ * Readers pull decimated values out of the ring: every output is the sum of 4^k
+ * consecutive samples shifted right by k, which gives k extra bits of resolution
+ * (12 + k bits) when the input carries some noise.
+ *
+ * With more than one channel the source interleaves them (ADC round robin), one
+ * sample of each per cycle, and every output carries one value per channel. The
+ * reader only ever moves by whole cycles, so it stays in step with the channels.
+ *
+ * The ring must hold at least two output blocks. A reader that falls more than
+ * half a ring behind is moved up to the newest samples and the skipped outputs are
+ * counted in overruns.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define ADC_CAPTURE_SAMPLE_BITS 12        // Resolution of a raw sample
+#define ADC_CAPTURE_MAX_OVERSAMPLE_BITS 6 // 4096 samples per output, the sum still fits 32 bits
+#define ADC_CAPTURE_MAX_CHANNELS 5        // ADC inputs 0-4
+
+/// @brief Hooks a source implements to report its progress
+typedef struct {
+    /// Total samples written so far, wrapping at 2^32
+    uint32_t (*head)(void *ctx);
+} adc_capture_source_t;
+
+typedef struct {
+    const adc_capture_source_t *source;  // < source filling the ring
+    void *ctx;                           // < source private data
+    const volatile uint16_t *ring;       // < samples, index is the sample count modulo ring_len
+    uint32_t ring_len;                   // < ring size in samples, a power of two
+    uint8_t channels;                    // < interleaved channels, the first sample read is channel 0
+    uint8_t oversample_bits;             // < k, outputs are 4^k samples per channel with 12 + k bits
+    uint32_t tail;                       // < count of the next sample to read
+    uint32_t overruns;                   // < outputs lost because the reader fell behind
+} adc_capture_t;
+
+/// @brief Attach a reader to a ring filled by a source
+/// @return false if ring_len is not a power of two holding two outputs, or k or channels are out of range
+bool adc_capture_init(adc_capture_t *cap, const adc_capture_source_t *source, void *ctx,
+                      const volatile uint16_t *ring, uint32_t ring_len, uint8_t channels, uint8_t oversample_bits);
+
+/// @brief Number of raw samples that make up one output
+static inline uint32_t adc_capture_block_len(const adc_capture_t *cap) {
+    return (uint32_t)cap->channels << (2 * cap->oversample_bits);
+}
+
+/// @brief Number of complete outputs waiting to be read
+uint32_t adc_capture_available(adc_capture_t *cap);
+
+/// @brief Read the oldest unread output, one value (12 + k bits) per channel into out
+/// @return false if no complete output is ready
+bool adc_capture_read(adc_capture_t *cap, uint32_t *out);
+
+/// @brief Read an output made of the newest samples and drop everything older
+/// @return false if a full block has not arrived since the last read
+bool adc_capture_read_latest(adc_capture_t *cap, uint32_t *out);
+
+/// @brief Drop everything unread and start again from the next sample the source writes
+/// @note Only call this while the source is stopped and restarts its channels from channel 0
+void adc_capture_resync(adc_capture_t *cap);
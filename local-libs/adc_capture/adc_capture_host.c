@@ -0,0 +1,32 @@
+#include "adc_capture_host.h"
+
+static uint32_t host_head(void *ctx) {
+    adc_capture_host_t *host = ctx;
+    return host->head;
+}
+
+static const adc_capture_source_t host_source = {
+    .head = host_head,
+};
+
+bool adc_capture_host_init(adc_capture_t *cap, adc_capture_host_t *host, uint16_t *ring, uint32_t ring_len,
+                           uint8_t channels, uint8_t oversample_bits) {
+    host->ring = ring;
+    host->ring_len = ring_len;
+    host->head = 0;
+    return adc_capture_init(cap, &host_source, host, ring, ring_len, channels, oversample_bits);
+}
+
+void adc_capture_host_feed(adc_capture_host_t *host, const uint16_t *samples, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        host->ring[host->head & (host->ring_len - 1)] = samples[i] & 0x0FFF;
+        host->head++;
+    }
+}
+
+void adc_capture_host_generate(adc_capture_host_t *host, adc_capture_host_signal_fn signal, void *user, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        host->ring[host->head & (host->ring_len - 1)] = signal(user, host->head) & 0x0FFF;
+        host->head++;
+    }
+}
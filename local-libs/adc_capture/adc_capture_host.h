@@ -0,0 +1,28 @@
+#pragma once
+
+/**
+ * Stand-in source for running the capture and decimation logic on a host.
+ * Samples are pushed into the ring by the test instead of the ADC and DMA.
+ */
+
+#include "adc_capture.h"
+
+/// @brief Synthetic signal, returns the raw 12-bit sample number n
+typedef uint16_t (*adc_capture_host_signal_fn)(void *user, uint32_t n);
+
+typedef struct {
+    uint16_t *ring;
+    uint32_t ring_len;
+    uint32_t head;  // < samples written so far
+} adc_capture_host_t;
+
+/// @brief Attach a reader to a ring fed by the host
+/// @return false for the same invalid parameters as adc_capture_init
+bool adc_capture_host_init(adc_capture_t *cap, adc_capture_host_t *host, uint16_t *ring, uint32_t ring_len,
+                           uint8_t channels, uint8_t oversample_bits);
+
+/// @brief Append samples to the ring, as the DMA would
+void adc_capture_host_feed(adc_capture_host_t *host, const uint16_t *samples, uint32_t count);
+
+/// @brief Append count samples generated by signal (n continues from the current head)
+void adc_capture_host_generate(adc_capture_host_t *host, adc_capture_host_signal_fn signal, void *user, uint32_t count);
@@ -0,0 +1,166 @@
+/**
+ * DMA source for the RP2040 ADC.
+ *
+ * The ADC runs free at the requested rate, round robin over the selected inputs
+ * when there are several, and pushes every conversion into its
+ * FIFO, a DMA channel paced by DREQ_ADC moves them into the ring using the DMA
+ * ring wrap. The channel is re-armed from its interrupt once per ring, which is
+ * also where full rings are counted, so the CPU is only involved once every
+ * ring_len samples (the 4 entry ADC FIFO covers the re-arm latency).
+ */
+
+#include "adc_capture_rp2040.h"
+
+#include <hardware/clocks.h>
+#include <hardware/dma.h>
+#include <hardware/irq.h>
+#include <pico/stdlib.h>
+
+typedef struct {
+    int dma;                 // < claimed channel, -1 when stopped
+    adc_capture_t *cap;      // < reader, resynced when conversions restart
+    uint input_mask;         // < inputs in the round robin
+    uint16_t *ring;
+    uint32_t ring_len;
+    volatile uint32_t laps;  // < completed rings
+} rp2040_source_t;
+
+static rp2040_source_t source = {.dma = -1};
+
+static uint32_t rp2040_head(void *ctx) {
+    rp2040_source_t *s = ctx;
+    uint32_t laps, pos;
+    do {
+        laps = s->laps;
+        if (dma_channel_is_busy(s->dma)) {
+            pos = (dma_hw->ch[s->dma].write_addr - (uintptr_t)s->ring) / sizeof(uint16_t);
+        } else {
+            pos = s->ring_len;  // ring finished, the interrupt has not re-armed it yet
+        }
+    } while (laps != s->laps);  // the interrupt ran in between
+    return laps * s->ring_len + pos;
+}
+
+static const adc_capture_source_t rp2040_source = {
+    .head = rp2040_head,
+};
+
+static void dma_irq_handler(void) {
+    if (source.dma < 0 || !dma_channel_get_irq1_status(source.dma)) {
+        return;  // shared with other DMA users
+    }
+    dma_channel_acknowledge_irq1(source.dma);
+
+    // Re-arm first so a reader can only ever see an old head, never a future one
+    dma_channel_set_trans_count(source.dma, source.ring_len, true);
+    source.laps++;
+}
+
+// Select the first input and the round robin, so conversions start at channel 0
+static void select_inputs(uint input_mask) {
+    uint first = 0;
+    while (!(input_mask & (1u << first))) {
+        first++;
+    }
+    adc_select_input(first);
+    adc_set_round_robin(input_mask == (1u << first) ? 0 : input_mask);
+}
+
+bool adc_capture_rp2040_start(adc_capture_t *cap, uint16_t *ring, uint32_t ring_len, uint8_t oversample_bits,
+                              uint input_mask, uint32_t sample_rate_hz) {
+    if (source.dma >= 0 || input_mask == 0 || input_mask > 0x1F || sample_rate_hz == 0) {
+        return false;
+    }
+    uint ring_bits = 0;
+    while ((1u << ring_bits) < ring_len * sizeof(uint16_t)) {
+        ring_bits++;
+    }
+    if (ring_bits > 15 || ((uintptr_t)ring & ((1u << ring_bits) - 1)) != 0) {
+        return false;  // the DMA can wrap at most 32 KB and needs the ring aligned to its size
+    }
+
+    uint8_t channels = 0;
+    for (uint input = 0; input < 5; input++) {
+        channels += (input_mask >> input) & 1;
+    }
+
+    source.cap = cap;
+    source.input_mask = input_mask;
+    source.ring = ring;
+    source.ring_len = ring_len;
+    source.laps = 0;
+    if (!adc_capture_init(cap, &rp2040_source, &source, ring, ring_len, channels, oversample_bits)) {
+        return false;
+    }
+
+    adc_init();
+    for (uint input = 0; input < 4; input++) {
+        if (input_mask & (1u << input)) {
+            adc_gpio_init(26 + input);
+        }
+    }
+    adc_set_temp_sensor_enabled(input_mask & (1u << 4));
+    select_inputs(input_mask);
+    adc_fifo_setup(true,    // write conversions to the FIFO
+                   true,    // raise DREQ for the DMA
+                   1,       // DREQ as soon as one sample is there
+                   false,   // no error bit, the samples stay 12 bit
+                   false);  // no shift to 8 bit
+    adc_set_clkdiv((float)clock_get_hz(clk_adc) / sample_rate_hz - 1);
+
+    source.dma = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(source.dma);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_ring(&c, true, ring_bits);
+    channel_config_set_dreq(&c, DREQ_ADC);
+    dma_channel_configure(source.dma, &c, ring, &adc_hw->fifo, ring_len, true);
+
+    dma_channel_set_irq1_enabled(source.dma, true);
+    irq_add_shared_handler(DMA_IRQ_1, dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
+
+    adc_fifo_drain();
+    adc_run(true);
+    return true;
+}
+
+void adc_capture_rp2040_stop(void) {
+    if (source.dma < 0) {
+        return;
+    }
+    adc_run(false);
+    dma_channel_set_irq1_enabled(source.dma, false);
+    irq_remove_handler(DMA_IRQ_1, dma_irq_handler);
+    dma_channel_abort(source.dma);
+    dma_channel_unclaim(source.dma);
+    adc_fifo_drain();
+    source.dma = -1;
+}
+
+void adc_capture_rp2040_pause(void) {
+    if (source.dma < 0) {
+        return;
+    }
+    adc_run(false);
+    while (!(adc_hw->cs & ADC_CS_READY_BITS)) {
+        tight_loop_contents();  // let the conversion in flight finish
+    }
+    while (adc_fifo_get_level() > 0) {
+        tight_loop_contents();  // and the DMA pick it up
+    }
+    adc_fifo_setup(true, false, 1, false, false);  // no DREQ, the DMA stays armed but idle
+    adc_set_round_robin(0);
+}
+
+void adc_capture_rp2040_resume(void) {
+    if (source.dma < 0) {
+        return;
+    }
+    adc_fifo_drain();
+    select_inputs(source.input_mask);
+    adc_capture_resync(source.cap);  // a partial round robin cycle may be in the ring
+    adc_fifo_setup(true, true, 1, false, false);
+    adc_run(true);
+}
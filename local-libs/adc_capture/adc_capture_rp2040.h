@@ -0,0 +1,30 @@
+#pragma once
+
+#include <hardware/adc.h>
+
+#include "adc_capture.h"
+
+/// @brief Declare a ring for the DMA source, aligned to its size as the DMA ring wrap requires
+#define ADC_CAPTURE_RING(name, len) static uint16_t name[len] __attribute__((aligned((len) * sizeof(uint16_t))))
+
+/// @brief Start the ADC free-running into ring through DMA and attach a reader to it
+/// @param cap reader to initialise
+/// @param ring buffer declared with ADC_CAPTURE_RING, at most 16384 samples
+/// @param ring_len ring size in samples, a power of two
+/// @param oversample_bits k, each output averages 4^k samples of every channel
+/// @param input_mask ADC inputs to sample in round robin (bits 0-3 are GPIO 26-29, bit 4 is the temperature
+///        sensor), channel 0 of the reader is the lowest input
+/// @param sample_rate_hz conversions per second over all inputs, up to 500000
+/// @return false if the parameters are invalid or the source is already running
+bool adc_capture_rp2040_start(adc_capture_t *cap, uint16_t *ring, uint32_t ring_len, uint8_t oversample_bits,
+                              uint input_mask, uint32_t sample_rate_hz);
+
+/// @brief Stop the ADC and release the DMA channel
+void adc_capture_rp2040_stop(void);
+
+/// @brief Halt conversions so the ADC can be used directly (e.g. adc_read on another input)
+/// @note Samples not read yet are dropped on resume, read them first
+void adc_capture_rp2040_pause(void);
+
+/// @brief Restart conversions after adc_capture_rp2040_pause, from channel 0
+void adc_capture_rp2040_resume(void);
@@ -0,0 +1,205 @@
+#include "adc_sampler.h"
+
+#include <hardware/adc.h>
+#include <pico/stdlib.h>
+#if CYW43_USES_VSYS_PIN
+#include <pico/cyw43_arch.h>
+#endif
+
+#include "adc_capture_rp2040.h"
+#include "sensor_fixed.h"
+
+#define ADC_SAMPLER_RING_LEN 2048  // Raw conversions kept by the DMA
+#define VSYS_SETTLE_READS 4        // Conversions dropped after switching to VSYS (they read low)
+
+typedef struct {
+    adc_sampler_sample_t samples[ADC_SAMPLER_HISTORY];
+    uint32_t count;  // < readings stored so far, the newest is at (count - 1) % ADC_SAMPLER_HISTORY
+} channel_history_t;
+
+static adc_sampler_config_t config;
+static bool running = false;
+static adc_capture_t capture;
+static uint8_t channel_of[ADC_CAPTURE_MAX_CHANNELS];  // capture channel to sampler channel
+static uint64_t output_period_us;                     // time covered by one capture output
+static channel_history_t history[ADC_SAMPLER_CHANNELS];
+static sensor_filter_stage_t *filters[ADC_SAMPLER_CHANNELS];
+
+ADC_CAPTURE_RING(adc_ring, ADC_SAMPLER_RING_LEN);
+
+static void store(uint8_t channel, int32_t uv_q7, uint64_t time_us) {
+    if (filters[channel] != NULL && !sensor_filter_run(filters[channel], uv_q7, &uv_q7)) {
+        return;  // swallowed by the filter (decimation, outlier)
+    }
+
+    channel_history_t *h = &history[channel];
+    taskENTER_CRITICAL();
+    adc_sampler_sample_t *s = &h->samples[h->count % ADC_SAMPLER_HISTORY];
+    s->uv_q7 = uv_q7;
+    s->time_us = time_us;
+    h->count++;
+    taskEXIT_CRITICAL();
+}
+
+// Move every complete capture output into the channel histories
+static void collect(void) {
+    uint32_t values[ADC_CAPTURE_MAX_CHANNELS];
+    uint64_t now = time_us_64();
+    uint32_t left = adc_capture_available(&capture);
+
+    while (left > 0 && adc_capture_read(&capture, values)) {
+        left--;
+        uint64_t time_us = now - left * output_period_us;  // outputs still queued behind this one are newer
+        for (uint8_t i = 0; i < capture.channels; i++) {
+            store(channel_of[i], sensor_fixed_adc_oversampled_to_uv_q7(values[i], config.oversample_bits), time_us);
+        }
+    }
+}
+
+static void read_vsys(void) {
+#if CYW43_USES_VSYS_PIN
+    if (!cyw43_is_initialized(&cyw43_state)) {
+        return;  // nothing to lock against yet, and the pin may be claimed any moment
+    }
+    cyw43_thread_enter();
+    cyw43_arch_gpio_get(CYW43_WL_GPIO_VBUS_PIN);  // make sure the chip is awake
+#endif
+
+    collect();  // the pause drops anything left in the ring
+    adc_capture_rp2040_pause();
+    adc_gpio_init(PICO_VSYS_PIN);
+    adc_select_input(ADC_SAMPLER_VSYS);
+
+    uint32_t reads = 1u << (2 * config.oversample_bits);
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < VSYS_SETTLE_READS + reads; i++) {
+        uint16_t raw = adc_read();
+        if (i >= VSYS_SETTLE_READS) {
+            sum += raw;
+        }
+    }
+    adc_capture_rp2040_resume();
+
+#if CYW43_USES_VSYS_PIN
+    cyw43_thread_exit();
+#endif
+
+    uint8_t k = config.oversample_bits;
+    uint32_t value = k == 0 ? sum : (sum + (1u << (k - 1))) >> k;
+    store(ADC_SAMPLER_VSYS, sensor_fixed_adc_oversampled_to_uv_q7(value, k), time_us_64());
+}
+
+static void adc_sampler_task(void *pvParameters) {
+    TickType_t last_wake = xTaskGetTickCount();
+    TickType_t last_vsys = last_wake - pdMS_TO_TICKS(config.vsys_period_ms);
+
+    while (true) {
+        collect();
+        if (config.vsys_period_ms > 0 && xTaskGetTickCount() - last_vsys >= pdMS_TO_TICKS(config.vsys_period_ms)) {
+            read_vsys();
+            last_vsys = xTaskGetTickCount();
+        }
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(config.service_period_ms));
+    }
+}
+
+bool adc_sampler_start(const adc_sampler_config_t *cfg) {
+    if (running || cfg->service_period_ms == 0) {
+        return false;
+    }
+#if CYW43_USES_VSYS_PIN
+    if (cfg->input_mask & (1u << ADC_SAMPLER_VSYS)) {
+        return false;  // converting GPIO 29 non stop would break the wireless chip's SPI
+    }
+#endif
+    config = *cfg;
+
+    if (!adc_capture_rp2040_start(&capture, adc_ring, ADC_SAMPLER_RING_LEN, config.oversample_bits,
+                                  config.input_mask, config.sample_rate_hz)) {
+        return false;
+    }
+    uint8_t n = 0;
+    for (uint8_t channel = 0; channel < ADC_SAMPLER_CHANNELS; channel++) {
+        if (config.input_mask & (1u << channel)) {
+            channel_of[n++] = channel;
+        }
+    }
+    output_period_us = (uint64_t)adc_capture_block_len(&capture) * 1000000 / config.sample_rate_hz;
+
+#if defined(configNUM_CORES) && configNUM_CORES > 1 && configUSE_CORE_AFFINITY
+    // Pinned from creation, the task may be started while the scheduler runs
+    UBaseType_t cores = config.cores != 0 ? config.cores : tskNO_AFFINITY;
+    BaseType_t created = xTaskCreateAffinitySet(adc_sampler_task, "ADC_SAMPLER", 256, NULL, config.priority, cores, NULL);
+#else
+    BaseType_t created = xTaskCreate(adc_sampler_task, "ADC_SAMPLER", 256, NULL, config.priority, NULL);
+#endif
+    if (created != pdPASS) {
+        adc_capture_rp2040_stop();
+        return false;
+    }
+    running = true;
+    return true;
+}
+
+uint32_t adc_sampler_inputs(void) {
+    return running ? config.input_mask : 0;
+}
+
+bool adc_sampler_set_filter(adc_sampler_channel_t channel, sensor_filter_stage_t *filter) {
+    if (running || channel >= ADC_SAMPLER_CHANNELS) {
+        return false;
+    }
+    filters[channel] = filter;
+    return true;
+}
+
+bool adc_sampler_latest(adc_sampler_channel_t channel, adc_sampler_sample_t *out) {
+    return adc_sampler_window(channel, 0, out, 1) == 1;
+}
+
+uint32_t adc_sampler_window(adc_sampler_channel_t channel, uint64_t since_us, adc_sampler_sample_t *out, uint32_t max) {
+    if (channel >= ADC_SAMPLER_CHANNELS) {
+        return 0;
+    }
+    channel_history_t *h = &history[channel];
+    uint32_t copied = 0;
+
+    taskENTER_CRITICAL();
+    uint32_t stored = h->count < ADC_SAMPLER_HISTORY ? h->count : ADC_SAMPLER_HISTORY;
+    while (copied < max && copied < stored) {
+        const adc_sampler_sample_t *s = &h->samples[(h->count - 1 - copied) % ADC_SAMPLER_HISTORY];
+        if (s->time_us < since_us) {
+            break;
+        }
+        out[copied++] = *s;
+    }
+    taskEXIT_CRITICAL();
+    return copied;
+}
+
+bool adc_sampler_mean(adc_sampler_channel_t channel, uint64_t since_us, int32_t *uv_q7) {
+    if (channel >= ADC_SAMPLER_CHANNELS) {
+        return false;
+    }
+    channel_history_t *h = &history[channel];
+    int64_t sum = 0;
+    uint32_t n = 0;
+
+    taskENTER_CRITICAL();
+    uint32_t stored = h->count < ADC_SAMPLER_HISTORY ? h->count : ADC_SAMPLER_HISTORY;
+    while (n < stored) {
+        const adc_sampler_sample_t *s = &h->samples[(h->count - 1 - n) % ADC_SAMPLER_HISTORY];
+        if (s->time_us < since_us) {
+            break;
+        }
+        sum += s->uv_q7;
+        n++;
+    }
+    taskEXIT_CRITICAL();
+
+    if (n == 0) {
+        return false;
+    }
+    *uv_q7 = (int32_t)((sum + n / 2) / n);
+    return true;
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+/**
+ * ADC sampling service.
+ *
+ * One task owns the ADC. The selected inputs are converted round robin by the
+ * free-running DMA capture, averaged (oversampled) and stored per channel with a
+ * timestamp. Any task, on either core, reads the latest value or a window of
+ * recent values without touching the ADC. A filter chain can be attached to each
+ * channel, the history then holds its output.
+ *
+ * VSYS can also be read on its own every vsys_period_ms. On the Pico W its pin
+ * (GPIO 29) is the wireless chip's SPI clock, so it cannot be in the round robin:
+ * the capture is paused for the read while holding the cyw43 lock, and the read
+ * is skipped until cyw43_arch_init has run.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "sensor_filter.h"
+
+#define ADC_SAMPLER_HISTORY 32       // Readings kept per channel
+#define ADC_SAMPLER_VSYS_DIVIDER 3   // VSYS is measured through a 1/3 divider
+
+/// @brief Channels, numbered as the ADC inputs
+typedef enum {
+    ADC_SAMPLER_GPIO26 = 0,
+    ADC_SAMPLER_GPIO27 = 1,
+    ADC_SAMPLER_GPIO28 = 2,
+    ADC_SAMPLER_VSYS = 3,  // < GPIO 29, VSYS / ADC_SAMPLER_VSYS_DIVIDER
+    ADC_SAMPLER_TEMP = 4,  // < on-die temperature sensor
+    ADC_SAMPLER_CHANNELS
+} adc_sampler_channel_t;
+
+typedef struct {
+    int32_t uv_q7;     // < voltage at the ADC input in Q7 microvolts (see sensor_fixed.h)
+    uint64_t time_us;  // < time the reading was complete
+} adc_sampler_sample_t;
+
+typedef struct {
+    uint32_t input_mask;          // < channels converted round robin (bit n is channel n)
+    uint32_t sample_rate_hz;      // < conversions per second over all those channels
+    uint8_t oversample_bits;      // < each reading averages 4^k conversions of its channel
+    uint32_t vsys_period_ms;      // < how often VSYS is read on its own, 0 for never
+    uint32_t service_period_ms;   // < how often new readings are collected
+    UBaseType_t priority;         // < priority of the service task
+    UBaseType_t cores;            // < core affinity mask of the service task, 0 for any (SMP core affinity only)
+} adc_sampler_config_t;
+
+/// @brief Start the ADC and the service task
+/// @return false if the configuration is invalid (VSYS in input_mask on a Pico W) or it is already running
+bool adc_sampler_start(const adc_sampler_config_t *config);
+
+/// @brief Channels being converted, bit n is channel n (0 until adc_sampler_start succeeded)
+uint32_t adc_sampler_inputs(void);
+
+/// @brief Run a channel's readings through a filter chain (NULL for none) before they are stored
+/// @note Call before adc_sampler_start, the chain is then only touched by the service task
+/// @return false if the channel is invalid or the service is already running
+bool adc_sampler_set_filter(adc_sampler_channel_t channel, sensor_filter_stage_t *filter);
+
+/// @brief Copy the newest reading of a channel
+/// @return false if the channel has no reading yet
+bool adc_sampler_latest(adc_sampler_channel_t channel, adc_sampler_sample_t *out);
+
+/// @brief Copy up to max readings taken at or after since_us, newest first
+/// @return number of readings copied
+uint32_t adc_sampler_window(adc_sampler_channel_t channel, uint64_t since_us, adc_sampler_sample_t *out, uint32_t max);
+
+/// @brief Average of the readings taken at or after since_us
+/// @return false if there are none
+bool adc_sampler_mean(adc_sampler_channel_t channel, uint64_t since_us, int32_t *uv_q7);
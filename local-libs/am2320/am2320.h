@@ -4,6 +4,9 @@
 #include <pico/stdlib.h>
 #include <stdio.h>
 
+#include "am2320_async.h"
+#include "i2c_bus.h"
+
 #define DEFAULT_SDA 10         // GPIO 10
 #define DEFAULT_SCL 11         // GPIO 11
 #define DEFAULT_I2C_PORT i2c1  // i2c1
@@ -14,6 +17,7 @@
 #define AM2320_CMD_READREG _u(0x03)       // < read register command
 #define AM2320_REG_TEMP_H _u(0x02)        // < high temp register address
 #define AM2320_REG_HUM_H _u(0x00)         // < high humidity register address
+#define AM2320_READ_TIMEOUT_MS 50         // < give up on a read after this long
 
 typedef struct {
     uint8_t address;   /**< i2c address of display*/
@@ -21,10 +25,22 @@ typedef struct {
 } am2320_t;
 
 typedef struct {
-    float temp;  // < temperature reading from the sensor in °C
-    float hum;   // < humidity reading from the sensor
+    am2320_status_t status;  // < AM2320_OK or why the read failed
+    int16_t temp;            // < temperature reading from the sensor in deci-degrees C
+    uint16_t hum;            // < humidity reading from the sensor in deci-percent RH
 } am2320_data;
 
 void test_temp_sensor();
 
+/// @brief Route sensor transfers through an asynchronous bus (NULL goes back to blocking on DEFAULT_I2C_PORT)
+/// Once a bus is set am2320_read_data uses the non-blocking driver (am2320_async.h) and sleeps instead of spinning
+void am2320_set_bus(i2c_bus_t *bus);
+
+/// @brief Write to the sensor, same semantics as i2c_write_blocking
+int am2320_i2c_write(const uint8_t *src, size_t len, bool nostop);
+
+/// @brief Read from the sensor, same semantics as i2c_read_blocking
+int am2320_i2c_read(uint8_t *dst, size_t len, bool nostop);
+
+/// @brief Read temperature and humidity, on failure status says why and the values are -40.0 C / 0 %
 am2320_data am2320_read_data();
@@ -2,32 +2,9 @@
 #include <unistd.h>
 
 #include "am2320.h"
+#include "string_operations.h"
 
-static uint16_t
-_calc_crc16(const uint8_t *buf, size_t len) {
-    uint16_t crc = 0xFFFF;
-
-    while (len--) {
-        crc ^= (uint16_t)*buf++;
-        for (unsigned i = 0; i < 8; i++) {
-            if (crc & 0x0001) {
-                crc >>= 1;
-                crc ^= 0xA001;
-            } else {
-                crc >>= 1;
-            }
-        }
-    }
-
-    return crc;
-}
-
-static uint16_t
-_combine_bytes(uint8_t msb, uint8_t lsb) {
-    return ((uint16_t)msb << 8) | (uint16_t)lsb;
-}
-
-int am2321(float *out_temperature, float *out_humidity) {
+am2320_status_t am2321(int16_t *out_temperature, uint16_t *out_humidity) {
     int fd;
     uint8_t data[8];
 
@@ -36,81 +13,45 @@ int am2321(float *out_temperature, float *out_humidity) {
      */
     //write(fd, NULL, 0);
     data[0] = 0;
-    i2c_write_blocking(DEFAULT_I2C_PORT, AM2320_ADDRESS, data, 1, true);
+    am2320_i2c_write(data, 1, true);
     sleep_ms(2);
     //usleep(1000); /* at least 0.8ms, at most 3ms */
 
     /* write at addr 0x03, start reg = 0x00, num regs = 0x04 */
-    data[0] = 0x03;
-    data[1] = 0x00;
-    data[2] = 0x04;
-    i2c_write_blocking(DEFAULT_I2C_PORT, AM2320_ADDRESS, data, 3, true);
+    data[0] = AM2320_CMD_READREG;
+    data[1] = AM2320_START_ADDRESS;
+    data[2] = AM2320_DATA_END_ADDRESS;
+    if (am2320_i2c_write(data, 3, true) == PICO_ERROR_GENERIC) {
+        return AM2320_ERR_BUS;
+    }
 
     /* wait for AM2320 */
     sleep_ms(3); /* Wait atleast 1.5ms */
 
-    /*
-     * Read out 8 bytes of data
-     * Byte 0: Should be Modbus function code 0x03
-     * Byte 1: Should be number of registers to read (0x04)
-     * Byte 2: Humidity msb
-     * Byte 3: Humidity lsb
-     * Byte 4: Temperature msb
-     * Byte 5: Temperature lsb
-     * Byte 6: CRC lsb byte
-     * Byte 7: CRC msb byte
-     */
-    i2c_read_blocking(DEFAULT_I2C_PORT, AM2320_ADDRESS, data, 8, false);
-
-    printf("[0x%02x 0x%02x  0x%02x 0x%02x  0x%02x 0x%02x  0x%02x 0x%02x]\n", data[0], data[1], data[2], data[3], data[4], data[5], data[6], data[7] );
-
-    /* Check data[0] and data[1] */
-    if (data[0] != 0x03 || data[1] != 0x04) {
-        printf("Invalid data read!\n");
-        return 9;
+    /* Read out 8 bytes of data, function code, count, humidity, temperature, CRC */
+    if (am2320_i2c_read(data, 8, false) == PICO_ERROR_GENERIC) {
+        return AM2320_ERR_BUS;
     }
 
-    /* Check CRC */
-    uint16_t crcdata = _calc_crc16(data, 6);
-    uint16_t crcread = _combine_bytes(data[7], data[6]);
-    if (crcdata != crcread) {
-        printf("CRC Checksum no match!\n");
-        return 10;
-    }
-
-    uint16_t temp16 = _combine_bytes(data[4], data[5]);
-    uint16_t humi16 = _combine_bytes(data[2], data[3]);
-    // printf("temp=%u 0x%04x  hum=%u 0x%04x\n", temp16, temp16, humi16, humi16);
-
-    /* Temperature resolution is 16Bit,
-     * temperature highest bit (Bit15) is equal to 1 indicates a
-     * negative temperature, the temperature highest bit (Bit15)
-     * is equal to 0 indicates a positive temperature;
-     * temperature in addition to the most significant bit (Bit14 ~ Bit0)
-     *  indicates the temperature sensor string value.
-     * Temperature sensor value is a string of 10 times the
-     * actual temperature value.
-     */
-    if (temp16 & 0x8000)
-        temp16 = -(temp16 & 0x7FFF);
-
-    *out_temperature = (float)temp16 / 10.0;
-    *out_humidity = (float)humi16 / 10.0;
-
-    return 0;
+    /* Same checks and conversions as am2320_read_data, values untouched on failure */
+    return am2320_decode_reply(data, out_temperature, out_humidity);
 }
 
 int read_temp_data(void) {
-    float temp, humi;
+    int16_t temp;
+    uint16_t humi;
+    char num[12];
 
-    int ret = am2321(&temp, &humi);
-    if (ret) {
+    am2320_status_t ret = am2321(&temp, &humi);
+    if (ret != AM2320_OK) {
         printf("Err=%d\n", ret);
         return ret;
     }
 
-    printf("Temperature %.1f [C]\n", temp);
-    printf("Humidity    %.1f [%%]\n", humi);
+    fixed_to_str(temp, 1, num, sizeof(num), 0, ' ');
+    printf("Temperature %s [C]\n", num);
+    fixed_to_str(humi, 1, num, sizeof(num), 0, ' ');
+    printf("Humidity    %s [%%]\n", num);
 
     return 0;
 }
@@ -1,3 +1,5 @@
 #pragma once
 
+/// @brief Print one temperature and humidity reading
+/// @return AM2320_OK or the am2320_status_t of the failed read
 int read_temp_data(void);
@@ -0,0 +1,148 @@
+#include "am2320_async.h"
+
+#include <pico/stdlib.h>
+
+#include "am2320.h"
+#include "crc16.h"
+#include "sensor_fixed.h"
+
+static void on_xfer_done(i2c_bus_xfer_t *xfer);
+
+static void submit(am2320_async_t *dev, const uint8_t *tx, size_t tx_len, uint8_t *rx, size_t rx_len) {
+    dev->xfer = (i2c_bus_xfer_t){
+        .addr = dev->address,
+        .tx = tx,
+        .tx_len = tx_len,
+        .rx = rx,
+        .rx_len = rx_len,
+        .done = on_xfer_done,
+        .user = dev,
+    };
+    i2c_bus_submit(dev->bus, &dev->xfer);
+}
+
+static void finish(am2320_async_t *dev, am2320_status_t status) {
+    am2320_result_t result = {.status = status, .time_us = time_us_64()};
+    if (status == AM2320_OK) {
+        result.status = am2320_decode_reply(dev->rx, &result.temp, &result.hum);
+    }
+
+    am2320_async_callback_t callback = dev->callback;
+    void *user = dev->user;
+
+    // Posted before the state is released: a reader that gave up on this read and starts another one empties
+    // the queue once its read is started, which is after this, so it never takes this result for its own
+    BaseType_t woken = pdFALSE;
+    if (dev->queue != NULL) {
+        xQueueSendFromISR(dev->queue, &result, &woken);
+    }
+    dev->state = AM2320_IDLE;  // the callback may start the next read
+    portYIELD_FROM_ISR(woken);
+
+    if (callback != NULL) {
+        callback(user, &result);
+    }
+}
+
+static void on_xfer_done(i2c_bus_xfer_t *xfer) {
+    am2320_async_t *dev = xfer->user;
+    switch (dev->state) {
+        case AM2320_WAKING:
+            // the sleeping sensor does not acknowledge the wake up call, the result means nothing
+            dev->state = AM2320_WAKE_WAIT;
+            dev->timer->start(dev->timer_ctx, AM2320_WAKE_US);
+            break;
+        case AM2320_REQUESTING:
+            if (xfer->result < 0) {
+                finish(dev, AM2320_ERR_BUS);
+                break;
+            }
+            dev->state = AM2320_CONVERT_WAIT;
+            dev->timer->start(dev->timer_ctx, AM2320_CONVERT_US);
+            break;
+        case AM2320_READING:
+            finish(dev, xfer->result == (int)sizeof(dev->rx) ? AM2320_OK : AM2320_ERR_BUS);
+            break;
+        default:
+            break;
+    }
+}
+
+void am2320_async_on_timer(am2320_async_t *dev) {
+    switch (dev->state) {
+        case AM2320_WAKE_WAIT:
+            // read 4 registers from 0x00: humidity high/low, temperature high/low
+            dev->tx[0] = AM2320_CMD_READREG;
+            dev->tx[1] = AM2320_START_ADDRESS;
+            dev->tx[2] = AM2320_DATA_END_ADDRESS;
+            dev->state = AM2320_REQUESTING;
+            submit(dev, dev->tx, 3, NULL, 0);
+            break;
+        case AM2320_CONVERT_WAIT:
+            dev->state = AM2320_READING;
+            submit(dev, NULL, 0, dev->rx, sizeof(dev->rx));
+            break;
+        default:
+            break;
+    }
+}
+
+void am2320_async_init(am2320_async_t *dev, i2c_bus_t *bus, uint8_t address, const am2320_async_timer_t *timer,
+                       void *timer_ctx) {
+    dev->bus = bus;
+    dev->address = address;
+    dev->timer = timer;
+    dev->timer_ctx = timer_ctx;
+    dev->queue = NULL;
+    dev->state = AM2320_IDLE;
+    dev->callback = NULL;
+    dev->user = NULL;
+}
+
+void am2320_async_set_queue(am2320_async_t *dev, QueueHandle_t queue) {
+    dev->queue = queue;
+}
+
+am2320_status_t am2320_async_read(am2320_async_t *dev, am2320_async_callback_t callback, void *user) {
+    bool start = false;
+    UBaseType_t saved = taskENTER_CRITICAL_FROM_ISR();
+    if (dev->state == AM2320_IDLE) {
+        dev->state = AM2320_WAKING;
+        start = true;
+    }
+    taskEXIT_CRITICAL_FROM_ISR(saved);
+    if (!start) {
+        return AM2320_ERR_BUSY;
+    }
+
+    dev->callback = callback;
+    dev->user = user;
+    dev->tx[0] = 0x00;
+    submit(dev, dev->tx, 1, NULL, 0);
+    return AM2320_OK;
+}
+
+bool am2320_async_busy(const am2320_async_t *dev) {
+    return dev->state != AM2320_IDLE;
+}
+
+am2320_status_t am2320_decode_reply(const uint8_t reply[8], int16_t *temp, uint16_t *hum) {
+    /*
+     * Byte 0: Modbus function code 0x03
+     * Byte 1: Number of bytes read (0x04)
+     * Byte 2-3: Humidity msb, lsb
+     * Byte 4-5: Temperature msb, lsb
+     * Byte 6-7: CRC lsb, msb
+     */
+    if (reply[0] != AM2320_CMD_READREG || reply[1] != AM2320_DATA_END_ADDRESS) {
+        return AM2320_ERR_FRAME;
+    }
+    uint16_t crc = (reply[7] << 8) | reply[6];
+    if (crc != crc16_modbus(reply, 6)) {
+        return AM2320_ERR_CRC;
+    }
+
+    *hum = sensor_fixed_am2320_hum_deci_pct((reply[2] << 8) | reply[3]);
+    *temp = sensor_fixed_am2320_temp_deci_c((reply[4] << 8) | reply[5]);
+    return AM2320_OK;
+}
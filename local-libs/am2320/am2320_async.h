@@ -0,0 +1,92 @@
+#pragma once
+
+/**
+ * Non-blocking AM2320 driver.
+ *
+ * A read walks wake -> wait -> request -> wait -> read -> check as a state
+ * machine. Bus transactions are submitted to an i2c_bus and the waits are timer
+ * callbacks, so nothing sleeps or spins: each step runs from the I2C or timer
+ * interrupt and the result is delivered by callback and/or queue.
+ *
+ * The timer is a small hook (the pico alarm pool on the device, a stand-in on the
+ * host), see am2320_async_rp2040.h and am2320_async_host.h.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <FreeRTOS.h>
+#include <queue.h>
+
+#include "i2c_bus.h"
+
+#define AM2320_WAKE_US 1000     // Sensor needs 0.8 to 3 ms after the wake up call
+#define AM2320_CONVERT_US 2000  // And at least 1.5 ms after the read request
+#define AM2320_MIN_INTERVAL_MS 2000  // Reads closer together return stale data and warm the sensor up
+
+typedef enum {
+    AM2320_OK = 0,
+    AM2320_ERR_BUS = -1,    // < the request or the read was not acknowledged
+    AM2320_ERR_FRAME = -2,  // < reply is not a 4 register read
+    AM2320_ERR_CRC = -3,    // < reply checksum mismatch
+    AM2320_ERR_BUSY = -4,   // < a read is already in progress
+} am2320_status_t;
+
+typedef struct {
+    am2320_status_t status;
+    int16_t temp;      // < deci-degrees C, valid with AM2320_OK
+    uint16_t hum;      // < deci-percent RH, valid with AM2320_OK
+    uint64_t time_us;  // < when the read completed
+} am2320_result_t;
+
+/// @brief Result callback, runs from interrupt context
+typedef void (*am2320_async_callback_t)(void *user, const am2320_result_t *result);
+
+/// @brief Hooks a timer implements for the waits
+typedef struct {
+    /// Call am2320_async_on_timer(dev) once, delay_us from now (may be called from interrupts)
+    void (*start)(void *ctx, uint32_t delay_us);
+} am2320_async_timer_t;
+
+typedef enum {
+    AM2320_IDLE,
+    AM2320_WAKING,        // < wake up call on the bus
+    AM2320_WAKE_WAIT,     // < waiting for the sensor to wake up
+    AM2320_REQUESTING,    // < read request on the bus
+    AM2320_CONVERT_WAIT,  // < waiting for the measurement
+    AM2320_READING,       // < reply on the bus
+} am2320_async_state_t;
+
+typedef struct {
+    i2c_bus_t *bus;
+    uint8_t address;                     // < 7 bit address of the sensor
+    const am2320_async_timer_t *timer;
+    void *timer_ctx;
+    QueueHandle_t queue;                 // < when set, results are also sent here (am2320_result_t items)
+    volatile am2320_async_state_t state;
+    i2c_bus_xfer_t xfer;
+    uint8_t tx[3];
+    uint8_t rx[8];
+    am2320_async_callback_t callback;
+    void *user;
+} am2320_async_t;
+
+/// @brief Set up a sensor at address on bus, driven by timer
+void am2320_async_init(am2320_async_t *dev, i2c_bus_t *bus, uint8_t address, const am2320_async_timer_t *timer,
+                       void *timer_ctx);
+
+/// @brief Also deliver results to queue (NULL to stop), sent with xQueueSendFromISR
+void am2320_async_set_queue(am2320_async_t *dev, QueueHandle_t queue);
+
+/// @brief Start a read, callback (may be NULL) gets the result
+/// @return AM2320_OK if started, AM2320_ERR_BUSY if a read is in progress
+am2320_status_t am2320_async_read(am2320_async_t *dev, am2320_async_callback_t callback, void *user);
+
+/// @brief True while a read is in progress
+bool am2320_async_busy(const am2320_async_t *dev);
+
+/// @brief Called by the timer when a wait is over
+void am2320_async_on_timer(am2320_async_t *dev);
+
+/// @brief Check and decode an 8 byte reply (function code, count, hum, temp, CRC)
+am2320_status_t am2320_decode_reply(const uint8_t reply[8], int16_t *temp, uint16_t *hum);
@@ -0,0 +1,93 @@
+#include "am2320_async_host.h"
+
+#include <pico/stdlib.h>
+
+#include "am2320.h"
+#include "crc16.h"
+
+#define SIM_WAKE_MIN_US 800      // The sensor takes this long to wake up
+#define SIM_WAKE_MAX_US 3000     // and falls asleep again if not asked within this
+#define SIM_CONVERT_MIN_US 1500  // A measurement takes this long
+
+static void host_timer_start(void *ctx, uint32_t delay_us) {
+    am2320_async_host_timer_t *timer = ctx;
+    timer->pending = true;
+    timer->delay_us = delay_us;
+    timer->total_delay_us += delay_us;
+}
+
+static const am2320_async_timer_t host_timer = {
+    .start = host_timer_start,
+};
+
+void am2320_async_host_init(am2320_async_t *dev, am2320_async_host_timer_t *timer, i2c_bus_t *bus, uint8_t address) {
+    timer->dev = dev;
+    timer->pending = false;
+    timer->delay_us = 0;
+    timer->total_delay_us = 0;
+    am2320_async_init(dev, bus, address, &host_timer, timer);
+}
+
+bool am2320_async_host_fire(am2320_async_host_timer_t *timer) {
+    if (!timer->pending) {
+        return false;
+    }
+    timer->pending = false;
+    am2320_async_on_timer(timer->dev);
+    return true;
+}
+
+int am2320_sim_device(void *user, i2c_bus_xfer_t *xfer) {
+    am2320_sim_t *sim = user;
+
+    if (xfer->addr != AM2320_ADDRESS) {
+        return PICO_ERROR_GENERIC;
+    }
+    if (!sim->awake) {
+        // asleep: the call wakes it up but is not acknowledged
+        sim->awake = true;
+        sim->wakes++;
+        sim->wake_us = sim->clock != NULL ? *sim->clock : 0;
+        return PICO_ERROR_GENERIC;
+    }
+    uint64_t now = sim->clock != NULL ? *sim->clock : 0;
+
+    if (xfer->tx_len == 3 && xfer->tx[0] == AM2320_CMD_READREG && xfer->tx[1] == AM2320_START_ADDRESS &&
+        xfer->tx[2] == AM2320_DATA_END_ADDRESS && xfer->rx_len == 0) {
+        if (sim->clock != NULL && now - sim->wake_us < SIM_WAKE_MIN_US) {
+            sim->timing_errors++;  // still waking up
+            return PICO_ERROR_GENERIC;
+        }
+        if (sim->clock != NULL && now - sim->wake_us > SIM_WAKE_MAX_US) {
+            sim->timing_errors++;  // asleep again
+            sim->awake = false;
+            return PICO_ERROR_GENERIC;
+        }
+        sim->requested = true;
+        sim->request_us = now;
+        return 3;
+    }
+
+    if (xfer->tx_len == 0 && xfer->rx_len == 8 && sim->requested) {
+        if (sim->clock != NULL && now - sim->request_us < SIM_CONVERT_MIN_US) {
+            sim->timing_errors++;  // measurement not ready
+            return PICO_ERROR_GENERIC;
+        }
+        uint8_t *r = xfer->rx;
+        r[0] = sim->bad_frame ? 0x80 : AM2320_CMD_READREG;
+        r[1] = AM2320_DATA_END_ADDRESS;
+        r[2] = sim->hum_raw >> 8;
+        r[3] = sim->hum_raw & 0xFF;
+        r[4] = sim->temp_raw >> 8;
+        r[5] = sim->temp_raw & 0xFF;
+        uint16_t crc = crc16_modbus(r, 6) ^ (sim->corrupt_crc ? 0x0001 : 0);
+        r[6] = crc & 0xFF;
+        r[7] = crc >> 8;
+        sim->requested = false;
+        sim->awake = false;  // back to sleep after answering
+        sim->replies++;
+        return 8;
+    }
+
+    return PICO_ERROR_GENERIC;
+}
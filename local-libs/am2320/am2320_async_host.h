@@ -0,0 +1,41 @@
+#pragma once
+
+/**
+ * Host stand-ins for the async AM2320 driver: a timer that fires when the test
+ * says so, and a simulated sensor to put on an i2c_bus_host bus.
+ */
+
+#include "am2320_async.h"
+#include "i2c_bus_host.h"
+
+typedef struct {
+    am2320_async_t *dev;
+    bool pending;             // < a wait is running
+    uint32_t delay_us;        // < length of the running wait
+    uint64_t total_delay_us;  // < all waits added up, the time a read takes
+} am2320_async_host_timer_t;
+
+typedef struct {
+    uint16_t temp_raw;   // < temperature word to report (sign-magnitude, tenths)
+    uint16_t hum_raw;    // < humidity word to report (tenths)
+    bool corrupt_crc;    // < send a reply with a wrong checksum
+    bool bad_frame;      // < send a reply with a wrong function code
+    bool awake;          // < woken up and not yet back to sleep
+    bool requested;      // < a read request is pending
+    uint32_t wakes;      // < wake up calls seen
+    uint32_t replies;    // < replies sent
+    const uint64_t *clock;   // < when set (microseconds), requests and reads sent at the wrong time are refused
+    uint64_t wake_us;        // < when the last wake up call came
+    uint64_t request_us;     // < when the last request came
+    uint32_t timing_errors;  // < requests or reads refused for their timing
+} am2320_sim_t;
+
+/// @brief Set up a sensor timed by the host timer
+void am2320_async_host_init(am2320_async_t *dev, am2320_async_host_timer_t *timer, i2c_bus_t *bus, uint8_t address);
+
+/// @brief End the running wait, as the alarm would
+/// @return false if no wait was running
+bool am2320_async_host_fire(am2320_async_host_timer_t *timer);
+
+/// @brief i2c_bus_host device function emulating an AM2320 (user is an am2320_sim_t)
+int am2320_sim_device(void *user, i2c_bus_xfer_t *xfer);
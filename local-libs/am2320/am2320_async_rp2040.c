@@ -0,0 +1,23 @@
+#include "am2320_async_rp2040.h"
+
+#include <pico/time.h>
+
+static int64_t alarm_callback(alarm_id_t id, void *user_data) {
+    am2320_async_on_timer(user_data);
+    return 0;  // one shot
+}
+
+static void alarm_start(void *ctx, uint32_t delay_us) {
+    if (add_alarm_in_us(delay_us, alarm_callback, ctx, true) < 0) {
+        // no free alarm slot, go on without the wait and let the sensor NACK if it was not ready
+        am2320_async_on_timer(ctx);
+    }
+}
+
+static const am2320_async_timer_t alarm_timer = {
+    .start = alarm_start,
+};
+
+void am2320_async_rp2040_init(am2320_async_t *dev, i2c_bus_t *bus, uint8_t address) {
+    am2320_async_init(dev, bus, address, &alarm_timer, dev);
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+#include "am2320_async.h"
+
+/// @brief Set up a sensor whose waits are timed by the pico default alarm pool
+void am2320_async_rp2040_init(am2320_async_t *dev, i2c_bus_t *bus, uint8_t address);
@@ -0,0 +1,269 @@
+#include "am2320_mux.h"
+
+#include <pico/stdlib.h>
+
+#include "am2320.h"
+
+static void on_xfer_done(i2c_bus_xfer_t *xfer);
+static void on_select_done(i2c_bus_xfer_t *xfer);
+
+static void finish_channel(am2320_mux_t *mux, uint8_t c, am2320_status_t status, uint64_t now) {
+    am2320_result_t *result = &mux->results[c];
+    result->status = status;
+    result->time_us = now;
+    if (status == AM2320_OK) {
+        result->status = am2320_decode_reply(mux->ch[c].rx, &result->temp, &result->hum);
+    }
+    mux->ch[c].state = AM2320_IDLE;
+    mux->in_flight &= ~(1u << c);
+}
+
+// Put the next step of channel c on the bus, behind a channel select if needed
+static void bus_step(am2320_mux_t *mux, uint8_t c, am2320_async_state_t state) {
+    am2320_mux_channel_t *ch = &mux->ch[c];
+    ch->state = state;
+    mux->on_bus = c;
+    mux->select_failed = false;
+
+    const uint8_t *tx = mux->tx;
+    size_t tx_len = 0;
+    uint8_t *rx = NULL;
+    size_t rx_len = 0;
+    switch (state) {
+        case AM2320_WAKING:
+            mux->to_wake &= ~(1u << c);
+            mux->in_flight |= 1u << c;
+            mux->tx[0] = 0x00;
+            tx_len = 1;
+            break;
+        case AM2320_REQUESTING:
+            // read 4 registers from 0x00: humidity high/low, temperature high/low
+            mux->tx[0] = AM2320_CMD_READREG;
+            mux->tx[1] = AM2320_START_ADDRESS;
+            mux->tx[2] = AM2320_DATA_END_ADDRESS;
+            tx_len = 3;
+            break;
+        default:
+            tx = NULL;
+            rx = ch->rx;
+            rx_len = sizeof(ch->rx);
+            break;
+    }
+
+    if (mux->selected != (1u << c)) {
+        mux->select_tx = 1u << c;
+        mux->selected = mux->select_tx;
+        mux->select_xfer = (i2c_bus_xfer_t){
+            .addr = mux->mux_address,
+            .tx = &mux->select_tx,
+            .tx_len = 1,
+            .done = on_select_done,
+            .user = mux,
+        };
+        i2c_bus_submit(mux->bus, &mux->select_xfer);
+    }
+    mux->xfer = (i2c_bus_xfer_t){
+        .addr = AM2320_ADDRESS,
+        .tx = tx,
+        .tx_len = tx_len,
+        .rx = rx,
+        .rx_len = rx_len,
+        .done = on_xfer_done,
+        .user = mux,
+    };
+    i2c_bus_submit(mux->bus, &mux->xfer);
+}
+
+static void bus_step_done(am2320_mux_t *mux, uint64_t now) {
+    uint8_t c = mux->on_bus;
+    am2320_mux_channel_t *ch = &mux->ch[c];
+    bool ok = !mux->select_failed && mux->xfer.result >= 0;
+    mux->on_bus = -1;
+
+    switch (ch->state) {
+        case AM2320_WAKING:
+            // the sleeping sensor does not acknowledge the wake up call, the result means nothing
+            ch->state = AM2320_WAKE_WAIT;
+            ch->ready_us = now + AM2320_WAKE_US;
+            break;
+        case AM2320_REQUESTING:
+            if (!ok) {
+                finish_channel(mux, c, AM2320_ERR_BUS, now);
+                break;
+            }
+            ch->state = AM2320_CONVERT_WAIT;
+            ch->ready_us = now + AM2320_CONVERT_US;
+            break;
+        default:
+            finish_channel(mux, c, ok && mux->xfer.result == (int)sizeof(ch->rx) ? AM2320_OK : AM2320_ERR_BUS, now);
+            break;
+    }
+}
+
+static void advance(am2320_mux_t *mux, uint64_t now) {
+    if (mux->bus_done) {
+        mux->bus_done = false;
+        bus_step_done(mux, now);
+    }
+    if (!mux->running || mux->on_bus >= 0) {
+        return;
+    }
+
+    // Find the oldest due request and read, and the next wait to end
+    int8_t request = -1, read = -1;
+    uint8_t awake = 0;
+    uint64_t earliest = UINT64_MAX;
+    for (uint8_t c = 0; c < AM2320_MUX_CHANNELS; c++) {
+        am2320_mux_channel_t *ch = &mux->ch[c];
+        if (ch->state == AM2320_WAKE_WAIT) {
+            awake++;
+        } else if (ch->state != AM2320_CONVERT_WAIT) {
+            continue;
+        }
+        if (ch->ready_us > now) {
+            earliest = ch->ready_us < earliest ? ch->ready_us : earliest;
+        } else if (ch->state == AM2320_WAKE_WAIT) {
+            request = request < 0 || ch->ready_us < mux->ch[request].ready_us ? c : request;
+        } else {
+            read = read < 0 || ch->ready_us < mux->ch[read].ready_us ? c : read;
+        }
+    }
+
+    if (request >= 0) {
+        bus_step(mux, request, AM2320_REQUESTING);  // has a deadline, the sensor falls asleep again
+    } else if (mux->to_wake != 0 && awake < AM2320_MUX_WAKE_AHEAD) {
+        bus_step(mux, __builtin_ctz(mux->to_wake), AM2320_WAKING);
+    } else if (read >= 0) {
+        bus_step(mux, read, AM2320_READING);
+    } else if (earliest != UINT64_MAX) {
+        if (earliest < mux->timer_at) {
+            if (mux->timer->start(mux->timer_ctx, earliest - now)) {
+                mux->timer_at = earliest;
+            } else if (earliest < mux->retry_at) {
+                mux->retry_at = earliest;  // step asks again without the lock
+            }
+        }
+    } else if (mux->to_wake == 0 && mux->in_flight == 0) {
+        mux->running = false;
+        mux->finished = true;
+    }
+}
+
+// Ask the timer again for a wait it refused under the lock. If it refuses again the wait is asked for by the
+// next step, a bus completion or an alarm of another wait
+static void retry_timer(am2320_mux_t *mux, uint64_t at) {
+    uint64_t now = mux->timer->now(mux->timer_ctx);
+    bool started = mux->timer->start(mux->timer_ctx, at > now ? (uint32_t)(at - now) : 0);
+    UBaseType_t saved = taskENTER_CRITICAL_FROM_ISR();
+    if (!started) {
+        mux->retry_at = at < mux->retry_at ? at : mux->retry_at;
+    } else if (at < mux->timer_at) {
+        mux->timer_at = at;
+    }
+    taskEXIT_CRITICAL_FROM_ISR(saved);
+}
+
+// Run the scheduler, from the bus interrupt, the timer interrupt or a task, on either core
+static void step(am2320_mux_t *mux, bool bus_done) {
+    am2320_mux_callback_t callback = NULL;
+    uint64_t retry_at;
+    UBaseType_t saved = taskENTER_CRITICAL_FROM_ISR();
+    if (bus_done) {
+        mux->bus_done = true;
+    }
+    if (mux->stepping) {
+        mux->again = true;  // a transfer completed inside bus_step, the outer call picks it up
+        taskEXIT_CRITICAL_FROM_ISR(saved);
+        return;
+    }
+
+    mux->stepping = true;
+    do {
+        mux->again = false;
+        advance(mux, mux->timer->now(mux->timer_ctx));
+    } while (mux->again);
+    mux->stepping = false;
+
+    if (mux->finished) {
+        mux->finished = false;
+        callback = mux->callback;
+    }
+    retry_at = mux->retry_at;
+    mux->retry_at = UINT64_MAX;
+    taskEXIT_CRITICAL_FROM_ISR(saved);
+
+    if (retry_at != UINT64_MAX) {
+        retry_timer(mux, retry_at);
+    }
+
+    if (callback != NULL) {
+        callback(mux->user, mux->results);  // may start the next read
+    }
+}
+
+static void on_select_done(i2c_bus_xfer_t *xfer) {
+    am2320_mux_t *mux = xfer->user;
+    if (xfer->result < 0) {
+        mux->select_failed = true;
+        mux->selected = 0;  // no telling what the mux has now
+    }
+}
+
+static void on_xfer_done(i2c_bus_xfer_t *xfer) {
+    step(xfer->user, true);
+}
+
+void am2320_mux_on_timer(am2320_mux_t *mux) {
+    UBaseType_t saved = taskENTER_CRITICAL_FROM_ISR();
+    mux->timer_at = UINT64_MAX;  // the next wait to end gets a new alarm
+    taskEXIT_CRITICAL_FROM_ISR(saved);
+    step(mux, false);
+}
+
+void am2320_mux_init(am2320_mux_t *mux, i2c_bus_t *bus, uint8_t mux_address, uint8_t channels,
+                     const am2320_mux_timer_t *timer, void *timer_ctx) {
+    mux->bus = bus;
+    mux->mux_address = mux_address;
+    mux->channels = channels;
+    mux->timer = timer;
+    mux->timer_ctx = timer_ctx;
+    mux->running = false;
+    mux->to_wake = 0;
+    mux->in_flight = 0;
+    mux->selected = 0;
+    mux->on_bus = -1;
+    mux->bus_done = false;
+    mux->timer_at = UINT64_MAX;
+    mux->retry_at = UINT64_MAX;
+    mux->stepping = false;
+    mux->finished = false;
+    mux->callback = NULL;
+    mux->user = NULL;
+    for (uint8_t c = 0; c < AM2320_MUX_CHANNELS; c++) {
+        mux->ch[c].state = AM2320_IDLE;
+        mux->results[c] = (am2320_result_t){.status = AM2320_ERR_BUSY};  // nothing read yet
+    }
+}
+
+am2320_status_t am2320_mux_read(am2320_mux_t *mux, am2320_mux_callback_t callback, void *user) {
+    UBaseType_t saved = taskENTER_CRITICAL_FROM_ISR();
+    if (mux->running) {
+        taskEXIT_CRITICAL_FROM_ISR(saved);
+        return AM2320_ERR_BUSY;
+    }
+    mux->running = true;
+    mux->to_wake = mux->channels;
+    mux->in_flight = 0;
+    mux->selected = 0;  // someone may have switched it meanwhile
+    mux->callback = callback;
+    mux->user = user;
+    mux->started_us = mux->timer->now(mux->timer_ctx);
+    taskEXIT_CRITICAL_FROM_ISR(saved);
+
+    step(mux, false);
+    return AM2320_OK;
+}
+
+bool am2320_mux_busy(const am2320_mux_t *mux) {
+    return mux->running;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+/**
+ * Several AM2320s behind a TCA9548A I2C multiplexer.
+ *
+ * Every AM2320 answers at AM2320_ADDRESS, so each one sits on its own mux
+ * channel. A read of all of them is pipelined: while one sensor wakes up or
+ * converts, the bus serves the next one, so the fixed waits (AM2320_WAKE_US,
+ * AM2320_CONVERT_US) overlap. N sensors take about one sensor's waits plus N
+ * times the bus transfers, instead of N times both.
+ *
+ * Each sensor goes through the same steps as in am2320_async (wake, wait,
+ * request, wait, read), and a bus step is preceded by a channel select when
+ * another channel is selected. A woken sensor has to be asked within about 3 ms,
+ * so due requests go first, then wakes, then due reads, and no more than
+ * AM2320_MUX_WAKE_AHEAD sensors are woken and not yet asked at a time.
+ *
+ * Like am2320_async everything runs from the bus and timer interrupts. The mux
+ * belongs to this driver: other bus users must not switch its channels (devices
+ * on the bus in front of the mux are fine).
+ *
+ * Host stand-ins for the mux, the sensors and the timer are in am2320_mux_host.h.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "am2320_async.h"
+#include "i2c_bus.h"
+
+#define TCA9548A_ADDRESS 0x70    // With A0-A2 low, up to 0x77
+#define AM2320_MUX_CHANNELS 8    // Channels of a TCA9548A
+#define AM2320_MUX_WAKE_AHEAD 2  // Sensors woken but not asked yet, more could miss their wake window
+
+/// @brief Called from interrupt context when every sensor is done, results are indexed by mux channel
+typedef void (*am2320_mux_callback_t)(void *user, const am2320_result_t *results);
+
+/// @brief Hooks a timer implements for the waits
+typedef struct {
+    /// Call am2320_mux_on_timer(mux) once, delay_us from now (may be called from interrupts, and under the mux
+    /// lock: never call it from here). A later start does not cancel an earlier one, extra calls are harmless
+    /// Returns false if no wait could be set up, the mux asks again once the lock is released
+    bool (*start)(void *ctx, uint32_t delay_us);
+    /// Current time in microseconds
+    uint64_t (*now)(void *ctx);
+} am2320_mux_timer_t;
+
+typedef struct {
+    am2320_async_state_t state;  // < AM2320_IDLE when not woken yet or done
+    uint64_t ready_us;           // < end of the running wait
+    uint8_t rx[8];
+} am2320_mux_channel_t;
+
+typedef struct {
+    i2c_bus_t *bus;
+    uint8_t mux_address;
+    uint8_t channels;  // < mux channels with a sensor, bit per channel
+    const am2320_mux_timer_t *timer;
+    void *timer_ctx;
+    am2320_mux_channel_t ch[AM2320_MUX_CHANNELS];
+    am2320_result_t results[AM2320_MUX_CHANNELS];  // < of the last read, for the channels in use
+    volatile bool running;
+    uint8_t to_wake;    // < channels of this read not woken yet
+    uint8_t in_flight;  // < channels woken and not done
+    uint8_t selected;   // < mux register as last written, 0 when unknown
+    int8_t on_bus;      // < channel whose step is on the bus, -1 if none
+    bool bus_done;      // < its transfer completed, not handled yet
+    bool select_failed;
+    uint64_t timer_at;  // < earliest alarm asked for, UINT64_MAX if none
+    uint64_t retry_at;  // < earliest wait the timer refused, UINT64_MAX if none
+    bool stepping;      // < advancing, a nested call only asks for another round
+    bool again;
+    bool finished;
+    uint64_t started_us;  // < when the last read started
+    i2c_bus_xfer_t select_xfer;
+    i2c_bus_xfer_t xfer;
+    uint8_t select_tx;
+    uint8_t tx[3];
+    am2320_mux_callback_t callback;
+    void *user;
+} am2320_mux_t;
+
+/// @brief Set up sensors on the given channels (bit per channel) of the mux at mux_address, driven by timer
+void am2320_mux_init(am2320_mux_t *mux, i2c_bus_t *bus, uint8_t mux_address, uint8_t channels,
+                     const am2320_mux_timer_t *timer, void *timer_ctx);
+
+/// @brief Start reading every sensor, callback (may be NULL) gets the results
+/// @return AM2320_OK if started, AM2320_ERR_BUSY if a read is in progress
+am2320_status_t am2320_mux_read(am2320_mux_t *mux, am2320_mux_callback_t callback, void *user);
+
+/// @brief True while a read is in progress
+bool am2320_mux_busy(const am2320_mux_t *mux);
+
+/// @brief Called by the timer when a wait may be over
+void am2320_mux_on_timer(am2320_mux_t *mux);
@@ -0,0 +1,126 @@
+#include "am2320_mux_host.h"
+
+#include <pico/stdlib.h>
+
+static bool host_alarm_start(void *ctx, uint32_t delay_us) {
+    am2320_mux_host_t *host = ctx;
+    uint64_t at = host->now_us + delay_us;
+    if (host->refuse_locked && host->mux->stepping) {
+        host->refused++;
+        return false;
+    }
+    if (host->alarm_count < AM2320_MUX_HOST_ALARMS) {
+        host->alarms[host->alarm_count++] = at;
+        return true;
+    }
+    // out of slots, keep the earlier alarms
+    uint8_t latest = 0;
+    for (uint8_t i = 1; i < host->alarm_count; i++) {
+        latest = host->alarms[i] > host->alarms[latest] ? i : latest;
+    }
+    if (at < host->alarms[latest]) {
+        host->alarms[latest] = at;
+    }
+    return true;
+}
+
+static uint64_t host_alarm_now(void *ctx) {
+    am2320_mux_host_t *host = ctx;
+    return host->now_us;
+}
+
+static const am2320_mux_timer_t host_timer = {
+    .start = host_alarm_start,
+    .now = host_alarm_now,
+};
+
+// Time on the wire: address, bytes and a repeated start address, 9 bits each plus start and stop
+static uint64_t wire_us(const am2320_mux_host_t *host, const i2c_bus_xfer_t *xfer) {
+    uint32_t bytes = 1 + xfer->tx_len + xfer->rx_len + (xfer->tx_len && xfer->rx_len ? 1 : 0);
+    return ((uint64_t)bytes * 9 + 2) * 1000000 / host->bus_hz;
+}
+
+void am2320_mux_host_init(am2320_mux_host_t *host, am2320_mux_t *mux, i2c_bus_t *bus, uint8_t populated,
+                          uint32_t bus_hz) {
+    host->mux = mux;
+    host->address = TCA9548A_ADDRESS;
+    host->populated = populated;
+    host->selected = 0;
+    host->bus_hz = bus_hz;
+    host->now_us = 0;
+    host->alarm_count = 0;
+    host->refuse_locked = false;
+    host->refused = 0;
+    host->log_len = 0;
+    for (uint8_t c = 0; c < AM2320_MUX_CHANNELS; c++) {
+        host->sensors[c] = (am2320_sim_t){.clock = &host->now_us};
+    }
+    i2c_bus_host_init(bus, &host->host, tca9548a_sim_device, host, true);
+    am2320_mux_init(mux, bus, TCA9548A_ADDRESS, populated, &host_timer, host);
+}
+
+bool am2320_mux_host_step(am2320_mux_host_t *host) {
+    if (host->host.pending != NULL) {
+        host->now_us += wire_us(host, host->host.pending);
+        return i2c_bus_host_service(&host->host);
+    }
+    if (host->alarm_count == 0) {
+        return false;
+    }
+
+    uint8_t next = 0;
+    for (uint8_t i = 1; i < host->alarm_count; i++) {
+        next = host->alarms[i] < host->alarms[next] ? i : next;
+    }
+    if (host->alarms[next] > host->now_us) {
+        host->now_us = host->alarms[next];
+    }
+    host->alarms[next] = host->alarms[--host->alarm_count];
+    am2320_mux_on_timer(host->mux);
+    return true;
+}
+
+uint64_t am2320_mux_host_run(am2320_mux_host_t *host) {
+    uint64_t start = host->now_us;
+    while (am2320_mux_busy(host->mux) && am2320_mux_host_step(host)) {
+    }
+    host->alarm_count = 0;  // left over alarms would find nothing to do
+    return host->now_us - start;
+}
+
+int tca9548a_sim_device(void *user, i2c_bus_xfer_t *xfer) {
+    am2320_mux_host_t *host = user;
+    int result = PICO_ERROR_GENERIC;
+
+    if (xfer->addr == host->address) {
+        if (xfer->tx_len == 1 && xfer->rx_len == 0) {
+            host->selected = xfer->tx[0];
+            result = 1;
+        } else if (xfer->tx_len == 0 && xfer->rx_len == 1) {
+            xfer->rx[0] = host->selected;
+            result = 1;
+        }
+    } else {
+        // the transfer reaches every enabled channel, any device there can acknowledge it
+        for (uint8_t c = 0; c < AM2320_MUX_CHANNELS; c++) {
+            if ((host->selected & host->populated & (1u << c)) != 0) {
+                int r = am2320_sim_device(&host->sensors[c], xfer);
+                result = r >= 0 ? r : result;
+            }
+        }
+    }
+
+    if (host->log_len < AM2320_MUX_HOST_LOG) {
+        host->log[host->log_len] = (am2320_mux_host_event_t){
+            .time_us = host->now_us,
+            .addr = xfer->addr,
+            .selected = host->selected,
+            .tx0 = xfer->tx_len ? xfer->tx[0] : 0,
+            .tx_len = xfer->tx_len,
+            .rx_len = xfer->rx_len,
+            .result = result,
+        };
+    }
+    host->log_len++;
+    return result;
+}
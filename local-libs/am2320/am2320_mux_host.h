@@ -0,0 +1,62 @@
+#pragma once
+
+/**
+ * Host stand-ins for am2320_mux: a TCA9548A with a simulated AM2320 on each
+ * channel, on a deferred i2c_bus_host bus, and a timer, all running on a
+ * simulated clock.
+ *
+ * am2320_mux_host_step runs the next event, either the transfer on the bus
+ * (the clock moves on by its time on the wire at bus_hz) or the next alarm, so
+ * a test can check the order of the transfers in the log and how long a read
+ * of N sensors takes. The sensors check their timing against the clock.
+ */
+
+#include "am2320_async_host.h"
+#include "am2320_mux.h"
+#include "i2c_bus_host.h"
+
+#define AM2320_MUX_HOST_ALARMS 16  // Alarms pending at once
+#define AM2320_MUX_HOST_LOG 128    // Transfers kept in the log
+
+typedef struct {
+    uint64_t time_us;  // < when the transfer ended
+    uint8_t addr;
+    uint8_t selected;  // < mux channels enabled during the transfer
+    uint8_t tx0;       // < first byte written, 0 if none
+    uint8_t tx_len;
+    uint8_t rx_len;
+    int result;
+} am2320_mux_host_event_t;
+
+typedef struct {
+    am2320_mux_t *mux;
+    i2c_bus_host_t host;
+    uint8_t address;   // < of the simulated mux
+    uint8_t populated;  // < channels with a sensor
+    uint8_t selected;  // < mux control register
+    am2320_sim_t sensors[AM2320_MUX_CHANNELS];
+    uint32_t bus_hz;
+    uint64_t now_us;  // < the simulated clock
+    uint64_t alarms[AM2320_MUX_HOST_ALARMS];
+    uint8_t alarm_count;
+    bool refuse_locked;  // < refuse alarms asked for under the mux lock, as if none were free there
+    uint32_t refused;    // < alarms refused so far
+    am2320_mux_host_event_t log[AM2320_MUX_HOST_LOG];
+    uint32_t log_len;  // < transfers so far, the log keeps the first AM2320_MUX_HOST_LOG
+} am2320_mux_host_t;
+
+/// @brief Set up mux (at TCA9548A_ADDRESS) on bus with sensors on the populated channels, transfers at bus_hz
+/// Sensor readings and faults are set through host->sensors
+void am2320_mux_host_init(am2320_mux_host_t *host, am2320_mux_t *mux, i2c_bus_t *bus, uint8_t populated,
+                          uint32_t bus_hz);
+
+/// @brief Run the next event: finish the transfer on the bus, or fire the next alarm
+/// @return false if nothing was pending
+bool am2320_mux_host_step(am2320_mux_host_t *host);
+
+/// @brief Step until the read in progress is done
+/// @return simulated microseconds it took from now
+uint64_t am2320_mux_host_run(am2320_mux_host_t *host);
+
+/// @brief i2c_bus_host device function emulating the mux and what is behind it (user is an am2320_mux_host_t)
+int tca9548a_sim_device(void *user, i2c_bus_xfer_t *xfer);
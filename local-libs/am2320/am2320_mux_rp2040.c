@@ -0,0 +1,40 @@
+#include "am2320_mux_rp2040.h"
+
+#include <pico/time.h>
+
+static int64_t alarm_callback(alarm_id_t id, void *user_data) {
+    am2320_mux_on_timer(user_data);
+    return 0;  // one shot
+}
+
+static void fallback_callback(TimerHandle_t timer) {
+    am2320_mux_on_timer(pvTimerGetTimerID(timer));
+}
+
+// Runs under the mux lock, so it never calls am2320_mux_on_timer itself
+static bool alarm_start(void *ctx, uint32_t delay_us) {
+    am2320_mux_rp2040_t *dev = ctx;
+    if (add_alarm_in_us(delay_us, alarm_callback, &dev->mux, true) >= 0) {
+        return true;
+    }
+    // no free alarm slot: whole ticks, one more for the tick in progress. A sensor may miss its wake window and
+    // report a bus error, which beats spinning until a slot frees up
+    const uint32_t tick_us = portTICK_PERIOD_MS * 1000;
+    TickType_t ticks = (TickType_t)((delay_us + tick_us - 1) / tick_us + 1);
+    return xTimerChangePeriodFromISR(dev->fallback, ticks, NULL) == pdPASS;
+}
+
+static uint64_t alarm_now(void *ctx) {
+    return time_us_64();
+}
+
+static const am2320_mux_timer_t alarm_timer = {
+    .start = alarm_start,
+    .now = alarm_now,
+};
+
+bool am2320_mux_rp2040_init(am2320_mux_rp2040_t *dev, i2c_bus_t *bus, uint8_t mux_address, uint8_t channels) {
+    am2320_mux_init(&dev->mux, bus, mux_address, channels, &alarm_timer, dev);
+    dev->fallback = xTimerCreate("am2320_mux", 1, pdFALSE, &dev->mux, fallback_callback);
+    return dev->fallback != NULL;
+}
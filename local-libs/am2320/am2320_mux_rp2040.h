@@ -0,0 +1,16 @@
+#pragma once
+
+#include <FreeRTOS.h>
+#include <timers.h>
+
+#include "am2320_mux.h"
+
+typedef struct {
+    am2320_mux_t mux;
+    TimerHandle_t fallback;  // < one shot FreeRTOS timer for the waits when every alarm is taken
+} am2320_mux_rp2040_t;
+
+/// @brief Set up sensors behind a mux, the waits are timed by the pico default alarm pool
+/// With no alarm free a wait goes to a FreeRTOS timer instead, a tick or two late
+/// @return false if the fallback timer could not be created
+bool am2320_mux_rp2040_init(am2320_mux_rp2040_t *dev, i2c_bus_t *bus, uint8_t mux_address, uint8_t channels);
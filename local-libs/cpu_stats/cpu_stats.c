@@ -0,0 +1,171 @@
+#include "cpu_stats.h"
+
+#include <hardware/timer.h>
+#include <stdio.h>
+#include <string.h>
+#include <task.h>
+
+#ifndef configIDLE_TASK_NAME
+#define configIDLE_TASK_NAME "IDLE"  // the kernel's default, tasks.c keeps it to itself
+#endif
+
+typedef struct {
+    volatile uint32_t busy_us;  // < only written by the core itself, read anywhere
+    volatile uint32_t idle_us;
+    uint32_t since_us;  // < when the running task was switched in
+    bool idle;          // < the running task is an idle task
+} core_time_t;
+
+typedef struct {
+    TaskHandle_t task;
+    uint32_t run_us;
+    uint32_t migrations;
+} task_time_t;
+
+// Where a task last ran and how often it moved, kept in its thread local storage slot:
+// core + 1 in the low byte (0 until it first ran), migrations above
+#define PLACE_CORE_MASK 0xffu
+#define PLACE_MIGRATIONS_SHIFT 8
+
+static core_time_t cores[CPU_STATS_CORES];
+
+// Previous snapshot
+static task_time_t last_tasks[CPU_STATS_MAX_TASKS];
+static UBaseType_t last_task_count = 0;
+static uint32_t last_total_us = 0;
+static uint32_t last_busy_us[CPU_STATS_CORES];
+static uint32_t last_idle_us[CPU_STATS_CORES];
+
+static TaskStatus_t status[CPU_STATS_MAX_TASKS];
+static TaskHandle_t reporter = NULL;
+
+uint32_t cpu_stats_time_us(void) {
+    return time_us_32();
+}
+
+void cpu_stats_switched_in(void) {
+#if CPU_STATS_CORES > 1
+    core_time_t *core = &cores[portGET_CORE_ID()];
+#else
+    core_time_t *core = &cores[0];
+#endif
+    uint32_t now = time_us_32();
+    if (core->since_us == 0) {
+        // first switch on this core, the time before the scheduler started is not counted
+    } else if (core->idle) {
+        core->idle_us += now - core->since_us;
+    } else {
+        core->busy_us += now - core->since_us;
+    }
+    core->since_us = now;
+    core->idle = strncmp(pcTaskGetName(NULL), configIDLE_TASK_NAME, sizeof(configIDLE_TASK_NAME) - 1) == 0;
+
+#if CPU_STATS_CORES > 1
+    uintptr_t place = (uintptr_t)pvTaskGetThreadLocalStoragePointer(NULL, CPU_STATS_TLS_INDEX);
+    uintptr_t core_id = (uintptr_t)(core - cores) + 1;
+    if ((place & PLACE_CORE_MASK) != core_id) {
+        uintptr_t migrations = (place >> PLACE_MIGRATIONS_SHIFT) + ((place & PLACE_CORE_MASK) != 0);
+        vTaskSetThreadLocalStoragePointer(NULL, CPU_STATS_TLS_INDEX,
+                                          (void *)((migrations << PLACE_MIGRATIONS_SHIFT) | core_id));
+    }
+#endif
+}
+
+bool cpu_stats_task_place(TaskHandle_t task, uint8_t *core, uint32_t *migrations) {
+#if CPU_STATS_CORES > 1
+    uintptr_t place = (uintptr_t)pvTaskGetThreadLocalStoragePointer(task, CPU_STATS_TLS_INDEX);
+#else
+    uintptr_t place = 1;  // always core 0
+#endif
+    *core = (uint8_t)((place & PLACE_CORE_MASK) - 1);
+    *migrations = (uint32_t)(place >> PLACE_MIGRATIONS_SHIFT);
+    return (place & PLACE_CORE_MASK) != 0;
+}
+
+bool cpu_stats_core_time(uint8_t core, uint32_t *busy_us, uint32_t *idle_us) {
+    if (core >= CPU_STATS_CORES) {
+        return false;
+    }
+    *busy_us = cores[core].busy_us;
+    *idle_us = cores[core].idle_us;
+    return true;
+}
+
+// part of total in tenths of a percent
+static uint32_t permille(uint32_t part, uint32_t total) {
+    return total > 0 ? (uint32_t)((uint64_t)part * 1000 / total) : 0;
+}
+
+static const task_time_t *last_time(TaskHandle_t task) {
+    static const task_time_t new_task = {0};  // new since the last snapshot
+    for (UBaseType_t i = 0; i < last_task_count; i++) {
+        if (last_tasks[i].task == task) {
+            return &last_tasks[i];
+        }
+    }
+    return &new_task;
+}
+
+void cpu_stats_print(void) {
+    uint32_t total_us;
+    UBaseType_t count = uxTaskGetSystemState(status, CPU_STATS_MAX_TASKS, &total_us);
+    uint32_t period_us = total_us - last_total_us;
+    last_total_us = total_us;
+
+    printf("cpu");
+    for (uint8_t core = 0; core < CPU_STATS_CORES; core++) {
+        uint32_t busy_us, idle_us;
+        cpu_stats_core_time(core, &busy_us, &idle_us);
+        uint32_t busy = busy_us - last_busy_us[core];
+        uint32_t load = permille(busy, busy + (idle_us - last_idle_us[core]));
+        last_busy_us[core] = busy_us;
+        last_idle_us[core] = idle_us;
+        printf(" core%u %lu.%lu%%", core, (unsigned long)load / 10, (unsigned long)load % 10);
+    }
+    if (count == 0) {
+        printf(", more than %d tasks\n", CPU_STATS_MAX_TASKS);
+        return;
+    }
+    printf(", %lu tasks\n", (unsigned long)count);
+
+    for (UBaseType_t i = 0; i < count; i++) {
+        const TaskStatus_t *task = &status[i];
+        const task_time_t *last = last_time(task->xHandle);
+        uint32_t share = permille(task->ulRunTimeCounter - last->run_us, period_us);
+        printf("  %-16s %3lu.%lu%%  stack %lu", task->pcTaskName, (unsigned long)share / 10,
+               (unsigned long)share % 10, (unsigned long)task->usStackHighWaterMark);
+
+#if CPU_STATS_CORES > 1
+        uint8_t core;
+        uint32_t migrations;
+        if (cpu_stats_task_place(task->xHandle, &core, &migrations)) {
+            printf("  core%u moved %lu", core, (unsigned long)(migrations - last->migrations));
+        }
+#endif
+        printf("\n");
+    }
+
+    for (UBaseType_t i = 0; i < count; i++) {
+        uint8_t core;
+        last_tasks[i].task = status[i].xHandle;
+        last_tasks[i].run_us = status[i].ulRunTimeCounter;
+        cpu_stats_task_place(status[i].xHandle, &core, &last_tasks[i].migrations);
+    }
+    last_task_count = count;
+}
+
+static void cpu_stats_task(void *pvParameters) {
+    TickType_t period = pdMS_TO_TICKS((uint32_t)(uintptr_t)pvParameters);
+    TickType_t last_wake = xTaskGetTickCount();
+    while (true) {
+        vTaskDelayUntil(&last_wake, period);
+        cpu_stats_print();
+    }
+}
+
+bool cpu_stats_start(uint32_t period_ms, UBaseType_t priority) {
+    if (reporter != NULL) {
+        return false;
+    }
+    return xTaskCreate(cpu_stats_task, "CPU_STATS", 512, (void *)(uintptr_t)period_ms, priority, &reporter) == pdPASS;
+}
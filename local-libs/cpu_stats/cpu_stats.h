@@ -0,0 +1,65 @@
+#pragma once
+
+/**
+ * CPU usage accounting.
+ *
+ * FreeRTOS run time stats (configGENERATE_RUN_TIME_STATS) count in microseconds
+ * from the RP2040 timer, so each task's counter is the time it ran, on either
+ * core. On top of that the task switch hook (traceTASK_SWITCHED_IN, see
+ * FreeRTOSConfig.h) splits each core's time into idle and busy.
+ *
+ * The reporter task prints a snapshot every period: the load of each core, then
+ * every task with its share of one core, the least free stack it ever had (in
+ * words), the core it last ran on and how often it moved from one core to the
+ * other. Shares and moves are since the previous snapshot, so a task that blocks
+ * the display loop, or one that keeps migrating, shows up right away.
+ *
+ *     cpu core0 41.2% core1 3.0%, 9 tasks
+ *       DISPLAY_TEMP      38.9%  stack 734  core1 moved 0
+ *       IDLE              58.7%  stack 201  core0 moved 2
+ *
+ * The core and migrations of a task are kept in its thread local storage slot
+ * CPU_STATS_TLS_INDEX, on the SMP kernel only.
+ *
+ * Counters are 32 bit microseconds: they wrap every 71 minutes, which differences
+ * over one period (or any interval shorter than that) do not mind.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#ifdef configNUM_CORES
+#define CPU_STATS_CORES configNUM_CORES
+#else
+#define CPU_STATS_CORES 1
+#endif
+
+#define CPU_STATS_MAX_TASKS 24  // Tasks a snapshot can show
+
+#ifndef CPU_STATS_TLS_INDEX
+#define CPU_STATS_TLS_INDEX 4  // Thread local storage slot for the core and migrations of each task
+#endif
+
+/// @brief Create the reporter task, a snapshot every period_ms
+/// @return false if it is already running or the task could not be created
+bool cpu_stats_start(uint32_t period_ms, UBaseType_t priority);
+
+/// @brief Print a snapshot of everything since the previous one (or since boot)
+void cpu_stats_print(void);
+
+/// @brief Time core spent in idle tasks and in other tasks, microseconds that wrap
+/// @return false if there is no such core
+bool cpu_stats_core_time(uint8_t core, uint32_t *busy_us, uint32_t *idle_us);
+
+/// @brief Core task last ran on and how many times it moved to another core since it was created
+/// @return false if it has not run yet
+bool cpu_stats_task_place(TaskHandle_t task, uint8_t *core, uint32_t *migrations);
+
+/// @brief Run time stats clock (portGET_RUN_TIME_COUNTER_VALUE)
+uint32_t cpu_stats_time_us(void);
+
+/// @brief Task switch hook (traceTASK_SWITCHED_IN), runs in the kernel on the switching core
+void cpu_stats_switched_in(void);
@@ -0,0 +1,21 @@
+#pragma once
+// CRC16/Modbus (poly 0xA001 reflected, init 0xFFFF), as used by the AM2320
+// and other Modbus style sensors.
+//
+// Table driven: 256 entries (512 bytes of flash, one lookup per byte) by default,
+// or 16 entries (32 bytes, two lookups per byte) with CRC16_MODBUS_NIBBLE_TABLE=1
+// for flash constrained builds.
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef CRC16_MODBUS_NIBBLE_TABLE
+#define CRC16_MODBUS_NIBBLE_TABLE 0
+#endif
+
+#define CRC16_MODBUS_INIT 0xFFFF
+
+// Continues a CRC over len more bytes, start with CRC16_MODBUS_INIT.
+uint16_t crc16_modbus_update(uint16_t crc, const uint8_t *buf, size_t len);
+
+// CRC of a whole buffer.
+uint16_t crc16_modbus(const uint8_t *buf, size_t len);
@@ -0,0 +1,60 @@
+#pragma once
+
+/**
+ * Sequence lock, for data with a single writer and any number of readers.
+ *
+ * The writer makes the sequence odd, updates the data and makes it even again.
+ * Readers copy the data without taking anything and retry if the sequence was
+ * odd or moved while they copied. Readers never block the writer or each other,
+ * so they can run on either core and in interrupts.
+ *
+ * A reader spins while a write is in progress, so the writer must not be
+ * interrupted by a reader on its own core: mask interrupts around the write
+ * (save_and_disable_interrupts) and keep it to a plain copy.
+ *
+ *     // writer                          // reader
+ *     seqlock_write_begin(&lock);        uint32_t seq;
+ *     data = latest;                     do {
+ *     seqlock_write_end(&lock);              seq = seqlock_read_begin(&lock);
+ *                                            copy = data;
+ *                                        } while (seqlock_read_retry(&lock, seq));
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+    volatile uint32_t seq;  // < odd while a write is in progress
+} seqlock_t;
+
+#define SEQLOCK_INIT {.seq = 0}
+
+static inline void seqlock_init(seqlock_t *lock) {
+    lock->seq = 0;
+}
+
+static inline void seqlock_write_begin(seqlock_t *lock) {
+    lock->seq++;
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);  // odd before any of the data changes
+}
+
+static inline void seqlock_write_end(seqlock_t *lock) {
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);  // all of the data before even
+    lock->seq++;
+}
+
+/// @brief Wait out a write in progress and return the sequence to check against
+static inline uint32_t seqlock_read_begin(const seqlock_t *lock) {
+    uint32_t seq;
+    while ((seq = lock->seq) & 1) {
+        // the writer is on the other core and only copies a few words
+    }
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    return seq;
+}
+
+/// @brief True if the data copied since seqlock_read_begin may be torn
+static inline bool seqlock_read_retry(const seqlock_t *lock, uint32_t seq) {
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    return lock->seq != seq;
+}
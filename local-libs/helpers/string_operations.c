@@ -59,3 +59,56 @@ void ftoa(float n, char* res, int afterpoint)
         intToStr((int)fpart, res + i + 1, afterpoint);
     }
 }
+
+int fixed_to_str(int32_t value, uint8_t decimals, char *buf, size_t size, uint8_t width, char pad)
+{
+    char digits[12];  // least significant first
+    uint32_t magnitude = value < 0 ? 0u - (uint32_t)value : (uint32_t)value;
+    int count = 0;
+
+    if (decimals > 9)
+        decimals = 9;
+
+    // at least one digit in front of the point
+    do {
+        digits[count++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude || count <= decimals);
+
+    size_t len = count + (decimals ? 1 : 0) + (value < 0 ? 1 : 0);
+    size_t total = len < width ? width : len;
+    if (total + 1 > size) {
+        if (size)
+            buf[0] = '\0';
+        return -1;
+    }
+
+    char* out = buf;
+    if (pad != '0') {
+        for (size_t i = len; i < total; i++)
+            *out++ = pad;
+    }
+    if (value < 0)
+        *out++ = '-';
+    if (pad == '0') {
+        for (size_t i = len; i < total; i++)
+            *out++ = '0';
+    }
+    while (count) {
+        if (count == decimals)
+            *out++ = '.';
+        *out++ = digits[--count];
+    }
+    *out = '\0';
+
+    return (int)total;
+}
+
+size_t str_append(char *buf, size_t size, size_t len, const char *s)
+{
+    while (*s && len + 1 < size)
+        buf[len++] = *s++;
+    if (len < size)
+        buf[len] = '\0';
+    return len;
+}
@@ -1,6 +1,8 @@
 #pragma once
 // C program for implementation of ftoa()
 #include <math.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
  
 // Converts a given integer x to string str[].
@@ -11,3 +13,13 @@ int intToStr(int x, char str[], int d);
 
 // Converts a floating-point/double number to a string.
 void ftoa(float n, char* res, int afterpoint);
+
+// Formats a fixed-point number (value / 10^decimals) into buf without touching
+// the heap or floating point, e.g. (-275, 1) gives "-27.5" and (5, 2) gives "0.05".
+// The result is padded on the left with pad (' ' or '0') up to width characters.
+// Returns the length written, or -1 (and an empty string) if buf is too small.
+int fixed_to_str(int32_t value, uint8_t decimals, char *buf, size_t size, uint8_t width, char pad);
+
+// Appends s to the string of length len held in buf, truncating at size.
+// Returns the new length.
+size_t str_append(char *buf, size_t size, size_t len, const char *s);
@@ -0,0 +1,145 @@
+#include "i2c_bus.h"
+
+#include <pico/stdlib.h>
+#include <string.h>
+
+void i2c_bus_init(i2c_bus_t *bus, const i2c_bus_transport_t *transport, void *ctx) {
+    memset(bus, 0, sizeof(*bus));
+    bus->transport = transport;
+    bus->ctx = ctx;
+}
+
+static void start_xfer(i2c_bus_t *bus, i2c_bus_xfer_t *xfer) {
+    xfer->start_us = time_us_64();
+    bus->transport->start(bus->ctx, xfer);
+}
+
+static void account(i2c_bus_t *bus, i2c_bus_xfer_t *xfer, uint64_t busy_us) {
+    bus->stats.xfers++;
+    bus->stats.busy_us += busy_us;
+    if (xfer->result < 0) {
+        bus->stats.errors++;
+    } else {
+        bus->stats.bytes += xfer->result;
+    }
+}
+
+// Put xfer on the bus, returns true if the bus was idle and the caller has to start it
+static bool enqueue(i2c_bus_t *bus, i2c_bus_xfer_t *xfer) {
+    bool start_now = false;
+    UBaseType_t saved = taskENTER_CRITICAL_FROM_ISR();
+    if (bus->current == NULL) {
+        bus->current = xfer;
+        start_now = true;
+    } else if (bus->tail == NULL) {
+        bus->head = bus->tail = xfer;
+    } else {
+        bus->tail->next = xfer;
+        bus->tail = xfer;
+    }
+    taskEXIT_CRITICAL_FROM_ISR(saved);
+    return start_now;
+}
+
+int i2c_bus_transfer(i2c_bus_t *bus, i2c_bus_xfer_t *xfer) {
+    xfer->next = NULL;
+    xfer->result = PICO_ERROR_GENERIC;
+
+    if (xfer->tx_len + xfer->rx_len == 0) {
+        return xfer->result;
+    }
+
+    // Nobody to wake up yet, so run the transaction in place
+    if (xTaskGetSchedulerState() != taskSCHEDULER_RUNNING) {
+        uint64_t start = time_us_64();
+        xfer->result = bus->transport->transfer_blocking(bus->ctx, xfer);
+        account(bus, xfer, time_us_64() - start);
+        return xfer->result;
+    }
+
+    xfer->waiter = xTaskGetCurrentTaskHandle();
+    xfer->done = NULL;
+    xTaskNotifyStateClearIndexed(NULL, I2C_BUS_NOTIFY_INDEX);
+
+    if (enqueue(bus, xfer)) {
+        start_xfer(bus, xfer);
+    }
+
+    ulTaskNotifyTakeIndexed(I2C_BUS_NOTIFY_INDEX, pdTRUE, portMAX_DELAY);
+    return xfer->result;
+}
+
+bool i2c_bus_submit(i2c_bus_t *bus, i2c_bus_xfer_t *xfer) {
+    xfer->next = NULL;
+    xfer->result = PICO_ERROR_GENERIC;
+    xfer->waiter = NULL;
+
+    if (xfer->tx_len + xfer->rx_len == 0) {
+        return false;
+    }
+
+    if (enqueue(bus, xfer)) {
+        start_xfer(bus, xfer);
+    }
+    return true;
+}
+
+int i2c_bus_write(i2c_bus_t *bus, uint8_t addr, const uint8_t *src, size_t len, bool nostop) {
+    i2c_bus_xfer_t xfer = {.addr = addr, .tx = src, .tx_len = len, .nostop = nostop};
+    return i2c_bus_transfer(bus, &xfer);
+}
+
+int i2c_bus_read(i2c_bus_t *bus, uint8_t addr, uint8_t *dst, size_t len, bool nostop) {
+    i2c_bus_xfer_t xfer = {.addr = addr, .rx = dst, .rx_len = len, .nostop = nostop};
+    return i2c_bus_transfer(bus, &xfer);
+}
+
+void i2c_bus_complete_from_isr(i2c_bus_t *bus, int result) {
+    UBaseType_t saved = taskENTER_CRITICAL_FROM_ISR();
+    i2c_bus_xfer_t *done = bus->current;
+    i2c_bus_xfer_t *next = bus->head;
+    if (next != NULL) {
+        bus->head = next->next;
+        if (bus->head == NULL) {
+            bus->tail = NULL;
+        }
+    }
+    bus->current = next;
+
+    done->result = result;
+    account(bus, done, time_us_64() - done->start_us);
+    taskEXIT_CRITICAL_FROM_ISR(saved);
+
+    // A woken waiter may return (and drop xfer off its stack) at once on the other core
+    TaskHandle_t waiter = done->waiter;
+    void (*callback)(i2c_bus_xfer_t *xfer) = waiter == NULL ? done->done : NULL;
+
+    BaseType_t woken = pdFALSE;
+    if (waiter != NULL) {
+        vTaskNotifyGiveIndexedFromISR(waiter, I2C_BUS_NOTIFY_INDEX, &woken);
+    }
+
+    // Keep the bus busy: the next transaction goes out straight from the interrupt
+    if (next != NULL) {
+        start_xfer(bus, next);
+    }
+
+    // Last, as the owner may reuse xfer (or submit another one) from its callback
+    if (callback != NULL) {
+        callback(done);
+    }
+
+    portYIELD_FROM_ISR(woken);
+}
+
+void i2c_bus_add_isr_time(i2c_bus_t *bus, uint64_t us) {
+    UBaseType_t saved = taskENTER_CRITICAL_FROM_ISR();
+    bus->stats.isr_us += us;
+    taskEXIT_CRITICAL_FROM_ISR(saved);
+}
+
+void i2c_bus_get_stats(i2c_bus_t *bus, i2c_bus_stats_t *out) {
+    taskENTER_CRITICAL();
+    *out = bus->stats;
+    taskEXIT_CRITICAL();
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+/**
+ * Asynchronous I2C bus driver.
+ *
+ * Transactions from any number of tasks are queued on the bus and executed one
+ * after another by a transport (the RP2040 I2C interrupt on the device, a
+ * stand-in on the host). The calling task blocks on a task notification while
+ * its transaction is on the wire, so other tasks on that core keep running.
+ *
+ * Before the scheduler is started the transport's blocking path is used instead.
+ *
+ * Drivers that cannot block (state machines run from timers or interrupts) submit
+ * a transaction with a completion callback instead, which runs from the
+ * transport's interrupt.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+/// Task notification slot used to signal transaction completion
+#define I2C_BUS_NOTIFY_INDEX 1
+
+/// @brief A single bus transaction: optional write phase followed by optional read phase
+typedef struct i2c_bus_xfer {
+    uint8_t addr;           // < 7 bit device address
+    const uint8_t *tx;      // < bytes to write (may be NULL when tx_len is 0)
+    size_t tx_len;          // < number of bytes to write
+    uint8_t *rx;            // < destination of read bytes (may be NULL when rx_len is 0)
+    size_t rx_len;          // < number of bytes to read, with a repeated start after the write phase
+    bool nostop;            // < keep the bus claimed after the transaction (next one starts with a restart)
+    int result;             // < bytes transferred or a PICO_ERROR_* code, valid once complete
+    TaskHandle_t waiter;    // < task blocked on this transaction
+    void (*done)(struct i2c_bus_xfer *xfer);  // < called from the interrupt when a submitted transaction is complete
+    void *user;             // < free for the owner of a submitted transaction
+    uint64_t start_us;      // < time the transport started the transaction
+    struct i2c_bus_xfer *next;  // < next queued transaction
+} i2c_bus_xfer_t;
+
+/// @brief Hooks a transport implements to move a transaction over the wire
+typedef struct {
+    /// Begin a transfer and return immediately, completion is reported with i2c_bus_complete_from_isr
+    void (*start)(void *ctx, i2c_bus_xfer_t *xfer);
+    /// Run a transfer to completion on the calling context, returns bytes transferred or PICO_ERROR_*
+    int (*transfer_blocking)(void *ctx, i2c_bus_xfer_t *xfer);
+} i2c_bus_transport_t;
+
+/// @brief Bus usage counters
+typedef struct {
+    uint32_t xfers;     // < completed transactions
+    uint32_t errors;    // < transactions that ended with an error
+    uint64_t bytes;     // < payload bytes moved
+    uint64_t busy_us;   // < time transactions spent on the wire
+    uint64_t isr_us;    // < CPU time spent servicing the transport interrupt
+} i2c_bus_stats_t;
+
+typedef struct {
+    const i2c_bus_transport_t *transport;  // < transport running the transactions
+    void *ctx;                             // < transport private data
+    i2c_bus_xfer_t *current;               // < transaction on the wire, NULL when idle
+    i2c_bus_xfer_t *head;                  // < first queued transaction
+    i2c_bus_xfer_t *tail;                  // < last queued transaction
+    i2c_bus_stats_t stats;                 // < usage counters
+} i2c_bus_t;
+
+/// @brief Initialise a bus on top of a transport
+void i2c_bus_init(i2c_bus_t *bus, const i2c_bus_transport_t *transport, void *ctx);
+
+/// @brief Queue a transaction and block the calling task until it is complete
+/// @return bytes transferred or a PICO_ERROR_* code
+int i2c_bus_transfer(i2c_bus_t *bus, i2c_bus_xfer_t *xfer);
+
+/// @brief Queue a transaction and return at once, xfer->done is called from the interrupt when it is complete
+/// @note Safe from tasks and interrupts. xfer and its buffers must stay valid until done is called.
+/// @return false if the transaction is empty (done is not called)
+bool i2c_bus_submit(i2c_bus_t *bus, i2c_bus_xfer_t *xfer);
+
+/// @brief Write len bytes to addr, same semantics as i2c_write_blocking
+int i2c_bus_write(i2c_bus_t *bus, uint8_t addr, const uint8_t *src, size_t len, bool nostop);
+
+/// @brief Read len bytes from addr, same semantics as i2c_read_blocking
+int i2c_bus_read(i2c_bus_t *bus, uint8_t addr, uint8_t *dst, size_t len, bool nostop);
+
+/// @brief Called by the transport (usually from its interrupt) when the current transaction is done
+void i2c_bus_complete_from_isr(i2c_bus_t *bus, int result);
+
+/// @brief Account CPU time the transport spent in its interrupt handler
+void i2c_bus_add_isr_time(i2c_bus_t *bus, uint64_t us);
+
+/// @brief Copy the usage counters
+void i2c_bus_get_stats(i2c_bus_t *bus, i2c_bus_stats_t *out);
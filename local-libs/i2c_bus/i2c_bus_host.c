@@ -0,0 +1,44 @@
+#include "i2c_bus_host.h"
+
+static int host_run(i2c_bus_host_t *host, i2c_bus_xfer_t *xfer) {
+    int result = host->device(host->user, xfer);
+    host->restart = xfer->nostop && result >= 0;
+    return result;
+}
+
+static void host_start(void *ctx, i2c_bus_xfer_t *xfer) {
+    i2c_bus_host_t *host = ctx;
+    host->pending = xfer;
+    if (!host->deferred) {
+        i2c_bus_host_service(host);
+    }
+}
+
+static int host_transfer_blocking(void *ctx, i2c_bus_xfer_t *xfer) {
+    return host_run(ctx, xfer);
+}
+
+static const i2c_bus_transport_t host_transport = {
+    .start = host_start,
+    .transfer_blocking = host_transfer_blocking,
+};
+
+void i2c_bus_host_init(i2c_bus_t *bus, i2c_bus_host_t *host, i2c_bus_host_device_fn device, void *user, bool deferred) {
+    host->bus = bus;
+    host->device = device;
+    host->user = user;
+    host->deferred = deferred;
+    host->pending = NULL;
+    host->restart = false;
+    i2c_bus_init(bus, &host_transport, host);
+}
+
+bool i2c_bus_host_service(i2c_bus_host_t *host) {
+    i2c_bus_xfer_t *xfer = host->pending;
+    if (xfer == NULL) {
+        return false;
+    }
+    host->pending = NULL;
+    i2c_bus_complete_from_isr(host->bus, host_run(host, xfer));
+    return true;
+}
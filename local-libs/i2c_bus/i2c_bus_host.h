@@ -0,0 +1,31 @@
+#pragma once
+
+/**
+ * Stand-in transport for running the bus queueing and completion logic on a
+ * host (e.g. the FreeRTOS POSIX port). Transactions are handed to a device
+ * callback instead of real hardware.
+ */
+
+#include "i2c_bus.h"
+
+/// @brief Emulated device, fills xfer->rx and returns bytes transferred or PICO_ERROR_*
+typedef int (*i2c_bus_host_device_fn)(void *user, i2c_bus_xfer_t *xfer);
+
+typedef struct {
+    i2c_bus_t *bus;
+    i2c_bus_host_device_fn device;
+    void *user;
+    bool deferred;            // < when true transactions wait for i2c_bus_host_service
+    i2c_bus_xfer_t *pending;  // < transaction started but not serviced yet
+    bool restart;             // < the transaction handed to the device starts with a repeated start
+                              //   (the previous one kept the bus and succeeded), as on the RP2040
+} i2c_bus_host_t;
+
+/// @brief Run a bus on the host stand-in
+/// @param deferred false completes transactions as soon as they start,
+///        true leaves them pending until i2c_bus_host_service is called
+void i2c_bus_host_init(i2c_bus_t *bus, i2c_bus_host_t *host, i2c_bus_host_device_fn device, void *user, bool deferred);
+
+/// @brief Complete the pending transaction, as the interrupt would on the device
+/// @return true if a transaction was completed
+bool i2c_bus_host_service(i2c_bus_host_t *host);
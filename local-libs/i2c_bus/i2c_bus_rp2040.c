@@ -0,0 +1,191 @@
+/**
+ * Interrupt driven transport for the RP2040 I2C blocks.
+ *
+ * The 16 entry TX FIFO is refilled from the I2C interrupt whenever it drops to
+ * half full, so the CPU is only involved once every few bytes. Completion is
+ * detected with STOP_DET (or TX_EMPTY/RX_FULL for transactions that keep the bus).
+ */
+
+#include "i2c_bus_rp2040.h"
+
+#include <hardware/irq.h>
+#include <pico/stdlib.h>
+
+#define I2C_FIFO_DEPTH 16
+
+typedef struct {
+    i2c_bus_t *bus;
+    i2c_inst_t *i2c;
+    i2c_bus_xfer_t *xfer;
+    size_t tx_pos;   // < write phase bytes pushed
+    size_t rx_req;   // < read commands pushed
+    size_t rx_pos;   // < bytes received
+    bool aborted;
+} rp2040_transport_t;
+
+static rp2040_transport_t transports[2];
+
+static void push_commands(rp2040_transport_t *t) {
+    i2c_hw_t *hw = i2c_get_hw(t->i2c);
+    i2c_bus_xfer_t *xfer = t->xfer;
+    size_t total = xfer->tx_len + xfer->rx_len;
+    bool rx_full = false;
+
+    while (t->tx_pos + t->rx_req < total && hw->txflr < I2C_FIFO_DEPTH) {
+        size_t n = t->tx_pos + t->rx_req;
+        uint32_t cmd;
+        if (t->tx_pos < xfer->tx_len) {
+            cmd = xfer->tx[t->tx_pos++];
+        } else {
+            // never request more bytes than the RX FIFO can hold
+            if (t->rx_req - t->rx_pos >= I2C_FIFO_DEPTH) {
+                rx_full = true;
+                break;
+            }
+            cmd = I2C_IC_DATA_CMD_CMD_BITS;
+            t->rx_req++;
+        }
+
+        if ((n == 0 && t->i2c->restart_on_next) || (n == xfer->tx_len && n != 0)) {
+            cmd |= I2C_IC_DATA_CMD_RESTART_BITS;
+        }
+        if (n == total - 1 && !xfer->nostop) {
+            cmd |= I2C_IC_DATA_CMD_STOP_BITS;
+        }
+        hw->data_cmd = cmd;
+    }
+
+    if (t->tx_pos + t->rx_req == total) {
+        // Everything queued, TX_EMPTY is only needed to detect the end of a write that keeps the bus
+        if (!(xfer->nostop && xfer->rx_len == 0)) {
+            hw_clear_bits(&hw->intr_mask, I2C_IC_INTR_MASK_M_TX_EMPTY_BITS);
+        }
+    } else if (rx_full) {
+        // Nothing can be pushed until bytes are read, TX_EMPTY would fire over and over until
+        // then. RX_FULL comes with the next byte and pushes (and unmasks) again.
+        hw_clear_bits(&hw->intr_mask, I2C_IC_INTR_MASK_M_TX_EMPTY_BITS);
+    } else {
+        hw_set_bits(&hw->intr_mask, I2C_IC_INTR_MASK_M_TX_EMPTY_BITS);
+    }
+}
+
+static void rp2040_start(void *ctx, i2c_bus_xfer_t *xfer) {
+    rp2040_transport_t *t = ctx;
+    i2c_hw_t *hw = i2c_get_hw(t->i2c);
+
+    t->xfer = xfer;
+    t->tx_pos = 0;
+    t->rx_req = 0;
+    t->rx_pos = 0;
+    t->aborted = false;
+
+    hw->enable = 0;
+    hw->tar = xfer->addr;
+    hw->enable = 1;
+
+    hw->tx_tl = I2C_FIFO_DEPTH / 2;
+    hw->rx_tl = 0;
+    (void)hw->clr_intr;
+
+    // TX_EMPTY fires straight away and the interrupt fills the FIFO
+    hw->intr_mask = I2C_IC_INTR_MASK_M_TX_EMPTY_BITS | I2C_IC_INTR_MASK_M_RX_FULL_BITS |
+                    I2C_IC_INTR_MASK_M_TX_ABRT_BITS | I2C_IC_INTR_MASK_M_STOP_DET_BITS;
+}
+
+static int rp2040_transfer_blocking(void *ctx, i2c_bus_xfer_t *xfer) {
+    rp2040_transport_t *t = ctx;
+    int written = 0;
+    int read = 0;
+
+    if (xfer->tx_len > 0) {
+        written = i2c_write_blocking(t->i2c, xfer->addr, xfer->tx, xfer->tx_len, xfer->rx_len > 0 || xfer->nostop);
+        if (written < 0) {
+            return written;
+        }
+    }
+    if (xfer->rx_len > 0) {
+        read = i2c_read_blocking(t->i2c, xfer->addr, xfer->rx, xfer->rx_len, xfer->nostop);
+        if (read < 0) {
+            return read;
+        }
+    }
+    return written + read;
+}
+
+static void rp2040_irq(rp2040_transport_t *t) {
+    uint64_t entry = time_us_64();
+    i2c_hw_t *hw = i2c_get_hw(t->i2c);
+    i2c_bus_xfer_t *xfer = t->xfer;
+    uint32_t status = hw->intr_stat;
+
+    if (xfer == NULL) {
+        hw->intr_mask = 0;
+        return;
+    }
+
+    if (status & I2C_IC_INTR_STAT_R_TX_ABRT_BITS) {
+        (void)hw->clr_tx_abrt;
+        t->aborted = true;
+        // The abort flushed the TX FIFO, TX_EMPTY would fire until the STOP
+        hw_clear_bits(&hw->intr_mask, I2C_IC_INTR_MASK_M_TX_EMPTY_BITS);
+    }
+
+    while (hw->rxflr > 0 && t->rx_pos < xfer->rx_len) {
+        xfer->rx[t->rx_pos++] = (uint8_t)hw->data_cmd;
+    }
+
+    bool done;
+    if (status & I2C_IC_INTR_STAT_R_STOP_DET_BITS) {
+        (void)hw->clr_stop_det;
+        done = true;
+    } else if (t->aborted) {
+        done = false;  // the controller still sends a STOP after an abort
+    } else {
+        push_commands(t);
+        bool all_pushed = t->tx_pos + t->rx_req == xfer->tx_len + xfer->rx_len;
+        bool tx_idle = hw->txflr == 0 && (hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_EMPTY_BITS);
+        done = xfer->nostop && all_pushed && t->rx_pos == xfer->rx_len && (xfer->rx_len > 0 || tx_idle);
+    }
+
+    i2c_bus_add_isr_time(t->bus, time_us_64() - entry);
+
+    if (done) {
+        hw->intr_mask = 0;
+        t->xfer = NULL;
+        t->i2c->restart_on_next = xfer->nostop && !t->aborted;
+        i2c_bus_complete_from_isr(t->bus, t->aborted ? PICO_ERROR_GENERIC : (int)(xfer->tx_len + xfer->rx_len));
+    }
+}
+
+// traceISR_ENTER / traceISR_EXIT mark the handlers in scheduler traces (FreeRTOSConfig.h, TRACE_RECORDER)
+static void i2c0_irq(void) {
+    traceISR_ENTER();
+    rp2040_irq(&transports[0]);
+    traceISR_EXIT();
+}
+
+static void i2c1_irq(void) {
+    traceISR_ENTER();
+    rp2040_irq(&transports[1]);
+    traceISR_EXIT();
+}
+
+static const i2c_bus_transport_t rp2040_transport = {
+    .start = rp2040_start,
+    .transfer_blocking = rp2040_transfer_blocking,
+};
+
+void i2c_bus_rp2040_init(i2c_bus_t *bus, i2c_inst_t *i2c) {
+    uint index = i2c_hw_index(i2c);
+    rp2040_transport_t *t = &transports[index];
+    t->bus = bus;
+    t->i2c = i2c;
+    t->xfer = NULL;
+
+    i2c_bus_init(bus, &rp2040_transport, t);
+
+    i2c_get_hw(i2c)->intr_mask = 0;
+    uint irq = index == 0 ? I2C0_IRQ : I2C1_IRQ;
+    irq_set_exclusive_handler(irq, index == 0 ? i2c0_irq : i2c1_irq);
+    irq_set_enabled(irq, true);
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <hardware/i2c.h>
+
+#include "i2c_bus.h"
+
+/// @brief Run a bus on an RP2040 I2C block using its interrupt
+/// @param bus the bus to initialise
+/// @param i2c an instance already set up with i2c_init and its GPIOs
+void i2c_bus_rp2040_init(i2c_bus_t *bus, i2c_inst_t *i2c);
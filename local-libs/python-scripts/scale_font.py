@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+
+# Pre-expands a font used by the SSD1306 driver for larger scales, so scaled
+# text can be drawn with the plain column-byte blitter instead of one square
+# per font bit.
+
+# usage: python3 scale_font.py <font.h> <font_name> <scale> [<scale> ...]
+# e.g.   python3 scale_font.py ../ssd1306/font.h font_8x5 2 3 4
+
+# Each scaled table is written in the same format as the source font, so it can
+# be passed to ssd1306_draw_string_with_font() with a scale of 1:
+# <height>, <width>, <additional spacing per char>, <first ascii char>, <last ascii char>, <data>
+
+import re
+import sys
+from pathlib import Path
+
+if len(sys.argv) < 4:
+    print("usage: python3 scale_font.py <font.h> <font_name> <scale> [<scale> ...]")
+    sys.exit()
+
+font_path = Path(sys.argv[1])
+font_name = sys.argv[2]
+scales = [int(s) for s in sys.argv[3:]]
+
+source = font_path.read_text()
+match = re.search(font_name + r'\[\]\s*=\s*\{(.*?)\};', source, re.S)
+if match is None:
+    raise Exception(f"Font {font_name} not found in {font_path}")
+
+# strip comments before pulling out the numbers
+body = re.sub(r'//.*|/\*.*?\*/', '', match.group(1), flags=re.S)
+values = [int(v, 0) for v in re.findall(r'0x[0-9a-fA-F]+|\d+', body)]
+
+height, width, spacing, first, last = values[:5]
+data = values[5:]
+parts_per_line = (height + 7) // 8
+
+
+def expand_column(parts, scale):
+    # join the column's parts into one integer, top pixel in bit 0,
+    # then repeat every bit `scale` times (ExpandByte generalised)
+    column = 0
+    for i, part in enumerate(parts):
+        column |= part << (8 * i)
+
+    expanded = 0
+    for bit in range(8 * len(parts)):
+        if column & (1 << bit):
+            expanded |= ((1 << scale) - 1) << (bit * scale)
+    return expanded
+
+
+def scale_font(scale):
+    scaled_height = height * scale
+    scaled_parts = (scaled_height + 7) // 8
+    out = [scaled_height, width * scale, spacing * scale, first, last]
+    for char in range(last - first + 1):
+        glyph = data[char * width * parts_per_line:(char + 1) * width * parts_per_line]
+        for w in range(width):
+            expanded = expand_column(glyph[w * parts_per_line:(w + 1) * parts_per_line], scale)
+            column = [(expanded >> (8 * i)) & 0xFF for i in range(scaled_parts)]
+            for _ in range(scale):
+                out.extend(column)
+    return out
+
+
+guard = f'_inc_{font_name}_scaled'
+with open(font_path.with_name(f'{font_name}_scaled.h'), 'wt') as file:
+    file.write(f'#ifndef {guard}\n#define {guard}\n\n')
+    file.write(f'/*\n * Generated by local-libs/python-scripts/scale_font.py from {font_name}, do not edit.\n')
+    file.write(' * Enable a table with SSD1306_FONT_SCALE_<n>=1 at build time.\n */\n')
+    for scale in scales:
+        table = scale_font(scale)
+        file.write(f'\n#if SSD1306_FONT_SCALE_{scale}\n')
+        file.write(f'static const uint8_t {font_name}_x{scale}[] =\n{{\n')
+        file.write('\t\t\t' + ', '.join(str(v) for v in table[:5]) + ',\n')
+        row = width * scale * ((height * scale + 7) // 8)
+        for i in range(5, len(table), row):
+            file.write('\t\t\t' + ', '.join(f'{v:#04x}' for v in table[i:i + row]) + ',\n')
+        file.write('};\n#endif\n')
+    file.write('\n#endif\n')
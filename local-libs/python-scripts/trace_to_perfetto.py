@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+
+# Converts a scheduler trace dumped by local-libs/trace_rec into the Chrome trace
+# JSON format, which https://ui.perfetto.dev and chrome://tracing open.
+
+# usage: python3 trace_to_perfetto.py <serial log> [<trace.json>]
+# e.g.   python3 trace_to_perfetto.py serial.log trace.json
+
+# The log is whatever came out of the USB serial port, other output around the
+# dump is ignored; the last complete dump ("trace begin" to "trace end") is used.
+# The trace has a "cores" process with a row per core (the tasks it ran and the
+# interrupts it took) and a "tasks" process with a row per task: running,
+# preempted (ready but another task had the core) or blocked and on what.
+
+import json
+import sys
+from pathlib import Path
+
+if len(sys.argv) < 2:
+    print("usage: python3 trace_to_perfetto.py <serial log> [<trace.json>]")
+    sys.exit()
+
+log_path = Path(sys.argv[1])
+out_path = Path(sys.argv[2]) if len(sys.argv) > 2 else log_path.with_suffix(".json")
+
+# trace_rec_event_t in trace_rec_hooks.h
+(TASK_IN, TASK_OUT, QUEUE_SEND, QUEUE_RECEIVE, QUEUE_SEND_ISR, QUEUE_RECEIVE_ISR, BLOCK_SEND, BLOCK_RECEIVE,
+ BLOCK_DELAY, BLOCK_NOTIFY, NOTIFY, NOTIFY_ISR, ISR_ENTER, ISR_EXIT) = range(1, 15)
+
+# queueQUEUE_TYPE_* in FreeRTOS queue.h: kind name, send verb, receive verb
+QUEUE_KINDS = {
+    0: ("queue", "send", "receive"),
+    1: ("mutex", "release", "take"),
+    2: ("counting semaphore", "give", "take"),
+    3: ("binary semaphore", "give", "take"),
+    4: ("recursive mutex", "release", "take"),
+}
+
+# RP2040 interrupt numbers (hardware/regs/intctrl.h)
+IRQ_NAMES = ["TIMER_0", "TIMER_1", "TIMER_2", "TIMER_3", "PWM_WRAP", "USBCTRL", "XIP", "PIO0_0", "PIO0_1",
+             "PIO1_0", "PIO1_1", "DMA_0", "DMA_1", "IO_BANK0", "IO_QSPI", "SIO_PROC0", "SIO_PROC1", "CLOCKS",
+             "SPI0", "SPI1", "UART0", "UART1", "ADC_FIFO", "I2C0", "I2C1", "RTC"]
+
+CORES_PID = 1
+TASKS_PID = 2
+
+
+def last_dump(lines):
+    dump = complete = None
+    for line in lines:
+        line = line.strip()
+        if line.startswith("trace begin"):
+            dump = [line]
+        elif dump is not None and line.startswith("trace "):
+            dump.append(line)
+            if line == "trace end":
+                complete, dump = dump, None
+    if complete is None:
+        raise Exception(f"No complete trace dump in {log_path}")
+    return complete
+
+
+dump = last_dump(log_path.read_text(errors="replace").splitlines())
+_, _, cores, now = dump[0].split()
+cores, now = int(cores), int(now)
+
+tasks = {}
+queues = {}
+events = []  # (time_us, core, order, event, aux, id)
+for line in dump[1:-1]:
+    fields = line.split(" ", 3)
+    if fields[1] == "task":
+        tasks[int(fields[2])] = fields[3] if len(fields) > 3 else ""
+    elif fields[1] == "queue":
+        kind, _, name = (fields[3] + " ").partition(" ")
+        queues[int(fields[2])] = (int(kind), name.strip())
+    elif fields[1] == "ev":
+        core = int(fields[2])
+        for entry in line.split()[3:]:
+            time_us = int(entry[0:8], 16)
+            # 32 bit timestamps: the age at dump time stays right across a wrap
+            age = (now - time_us) & 0xFFFFFFFF
+            events.append((-age, core, len(events), int(entry[8:10], 16), int(entry[10:12], 16),
+                           int(entry[12:16], 16)))
+
+if not events:
+    raise Exception("The dump holds no events, was the recorder started?")
+events.sort()
+start = events[0][0]
+end = events[-1][0]
+
+
+def task_name(number):
+    return tasks.get(number, f"task {number}")
+
+
+def queue_name(number):
+    kind, name = queues.get(number, (0, ""))
+    return name if name else f"{QUEUE_KINDS.get(kind, QUEUE_KINDS[0])[0]} {number}"
+
+
+def queue_op(event, number):
+    kind = queues.get(number, (0, ""))[0]
+    _, send, receive = QUEUE_KINDS.get(kind, QUEUE_KINDS[0])
+    verb = send if event in (QUEUE_SEND, QUEUE_SEND_ISR) else receive
+    return f"{verb} {queue_name(number)}"
+
+
+def isr_name(exception):
+    if exception == 15:
+        return "SysTick"
+    irq = exception - 16
+    return f"IRQ {IRQ_NAMES[irq]}" if 0 <= irq < len(IRQ_NAMES) else f"exception {exception}"
+
+
+out = []
+
+
+def add_slice(pid, tid, name, begin, finish, args=None):
+    event = {"name": name, "ph": "X", "pid": pid, "tid": tid, "ts": begin - start, "dur": finish - begin}
+    if args:
+        event["args"] = args
+    out.append(event)
+
+
+def instant(pid, tid, name, time_us):
+    out.append({"name": name, "ph": "i", "s": "t", "pid": pid, "tid": tid, "ts": time_us - start})
+
+
+running = {}  # core -> (task, since)
+isrs = {core: [] for core in range(cores)}  # core -> [(exception, since)]
+waiting = {}  # task -> (state, since)
+blocked_on = {}  # task -> what it blocked on while running
+
+for time_us, core, _, event, aux, number in events:
+    current = running.get(core, (None, None))[0]
+
+    if event == TASK_IN:
+        if core in running:  # the switch out fell off the ring
+            task, since = running.pop(core)
+            add_slice(CORES_PID, core, task_name(task), since, time_us)
+            add_slice(TASKS_PID, task, "running", since, time_us, {"core": core})
+        if number in waiting:
+            state, since = waiting.pop(number)
+            add_slice(TASKS_PID, number, state, since, time_us)
+        running[core] = (number, time_us)
+    elif event == TASK_OUT:
+        task, since = running.pop(core, (number, start))
+        add_slice(CORES_PID, core, task_name(task), since, time_us)
+        add_slice(TASKS_PID, task, "running", since, time_us, {"core": core})
+        reason = blocked_on.pop(task, None)
+        waiting[task] = (f"blocked: {reason}" if reason else "preempted", time_us)
+    elif event in (BLOCK_SEND, BLOCK_RECEIVE):
+        blocked_on[current] = queue_op(QUEUE_SEND if event == BLOCK_SEND else QUEUE_RECEIVE, number)
+    elif event == BLOCK_DELAY:
+        blocked_on[current] = "delay"
+    elif event == BLOCK_NOTIFY:
+        blocked_on[current] = f"notify {aux}"
+    elif event == ISR_ENTER:
+        isrs[core].append((aux, time_us))
+    elif event == ISR_EXIT:
+        if isrs[core]:
+            exception, since = isrs[core].pop()
+            add_slice(CORES_PID, core, isr_name(exception), since, time_us)
+    else:
+        if event in (NOTIFY, NOTIFY_ISR):
+            name = f"notify {aux}"
+        else:
+            name = queue_op(event, number)
+        if isrs[core] or current is None or event in (QUEUE_SEND_ISR, QUEUE_RECEIVE_ISR, NOTIFY_ISR):
+            instant(CORES_PID, core, name, time_us)
+        else:
+            instant(TASKS_PID, current, name, time_us)
+
+# Whatever is still open runs to the last event
+for core, (task, since) in running.items():
+    add_slice(CORES_PID, core, task_name(task), since, end)
+    add_slice(TASKS_PID, task, "running", since, end, {"core": core})
+for task, (state, since) in waiting.items():
+    add_slice(TASKS_PID, task, state, since, end)
+for core, stack in isrs.items():
+    for exception, since in stack:
+        add_slice(CORES_PID, core, isr_name(exception), since, end)
+
+out.append({"name": "process_name", "ph": "M", "pid": CORES_PID, "args": {"name": "cores"}})
+out.append({"name": "process_name", "ph": "M", "pid": TASKS_PID, "args": {"name": "tasks"}})
+for core in range(cores):
+    out.append({"name": "thread_name", "ph": "M", "pid": CORES_PID, "tid": core, "args": {"name": f"core {core}"}})
+seen = {e["tid"] for e in out if e.get("pid") == TASKS_PID and e["ph"] != "M"}
+for task in sorted(seen):
+    out.append({"name": "thread_name", "ph": "M", "pid": TASKS_PID, "tid": task, "args": {"name": task_name(task)}})
+
+out_path.write_text(json.dumps({"traceEvents": out, "displayTimeUnit": "ms"}))
+print(f"{len(events)} events over {(end - start) / 1000:.1f} ms, {len(seen)} tasks -> {out_path}")
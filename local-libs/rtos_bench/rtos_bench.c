@@ -0,0 +1,319 @@
+#include "rtos_bench.h"
+
+#include <queue.h>
+#include <semphr.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "task_signal.h"
+
+#define MAX_TASKS (RTOS_BENCH_WORKERS + 1)  // workers and the notified sink
+#define SINK RTOS_BENCH_WORKERS
+
+enum { PING, PONG };
+
+static const char *const scenario_names[RTOS_BENCH_SCENARIOS] = {"ping-pong", "contention"};
+static const char *const primitive_names[RTOS_BENCH_PRIMITIVES] = {"queue", "semaphore", "mutex", "notify"};
+static const char *const placement_names[RTOS_BENCH_PLACEMENTS] = {"same core", "cross core"};
+static const char *const priority_names[RTOS_BENCH_PRIORITY_MODES] = {"equal", "staggered"};
+
+// The running case, set up by rtos_bench_run before the tasks are let go
+static struct {
+    rtos_bench_primitive_t primitive;
+    uint32_t rounds;  // < per ping-pong, per worker in contention
+    QueueHandle_t queues[2];
+    SemaphoreHandle_t semaphores[2];
+    SemaphoreHandle_t mutex;
+    task_signal_t signals[MAX_TASKS];  // < to each task, for the notify cases
+    task_signal_t done;                // < to the controller, once per finished task
+    uint64_t start_us;                 // < ping-pong only, after the warm up
+    uint64_t end_us;
+} bench;
+
+static uint32_t samples_us[RTOS_BENCH_MAX_SAMPLES];
+
+static uint32_t elapsed_us(uint64_t since) {
+    return (uint32_t)(rtos_bench_time_us() - since);
+}
+
+// Wait until the controller lets every task go. This is on notification slot 0,
+// so a notify case signal that arrives first is not taken for the start.
+static void wait_start(void) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+}
+
+// Report to the controller and wait to be deleted
+static void finish(void) {
+    task_signal_give(&bench.done);
+    vTaskSuspend(NULL);
+}
+
+static void signal_side(int to) {
+    uint32_t value = 0;
+    switch (bench.primitive) {
+        case RTOS_BENCH_QUEUE:
+            xQueueSend(bench.queues[to], &value, portMAX_DELAY);
+            break;
+        case RTOS_BENCH_SEMAPHORE:
+            xSemaphoreGive(bench.semaphores[to]);
+            break;
+        default:
+            task_signal_give(&bench.signals[to]);
+            break;
+    }
+}
+
+static void wait_side(int side) {
+    uint32_t value;
+    switch (bench.primitive) {
+        case RTOS_BENCH_QUEUE:
+            xQueueReceive(bench.queues[side], &value, portMAX_DELAY);
+            break;
+        case RTOS_BENCH_SEMAPHORE:
+            xSemaphoreTake(bench.semaphores[side], portMAX_DELAY);
+            break;
+        default:
+            task_signal_take(&bench.signals[side], portMAX_DELAY);
+            break;
+    }
+}
+
+static void ping_task(void *pvParameters) {
+    wait_start();
+    for (uint32_t round = 0; round < RTOS_BENCH_WARMUP + bench.rounds; round++) {
+        if (round == RTOS_BENCH_WARMUP) {
+            bench.start_us = rtos_bench_time_us();
+        }
+        uint64_t start = rtos_bench_time_us();
+        signal_side(PONG);
+        wait_side(PING);
+        if (round >= RTOS_BENCH_WARMUP) {
+            samples_us[round - RTOS_BENCH_WARMUP] = elapsed_us(start);
+        }
+    }
+    bench.end_us = rtos_bench_time_us();
+    finish();
+}
+
+static void pong_task(void *pvParameters) {
+    wait_start();
+    for (uint32_t round = 0; round < RTOS_BENCH_WARMUP + bench.rounds; round++) {
+        wait_side(PONG);
+        signal_side(PING);
+    }
+    finish();
+}
+
+// One contention operation, returns the time spent in the primitive
+static uint32_t contend(void) {
+    uint64_t start = rtos_bench_time_us();
+    uint32_t value = 0;
+    SemaphoreHandle_t lock = bench.mutex;
+    switch (bench.primitive) {
+        case RTOS_BENCH_QUEUE:
+            xQueueSend(bench.queues[0], &value, portMAX_DELAY);  // one slot per worker, never full
+            xQueueReceive(bench.queues[0], &value, portMAX_DELAY);
+            return elapsed_us(start);
+        case RTOS_BENCH_NOTIFY:
+            task_signal_give(&bench.signals[SINK]);
+            return elapsed_us(start);
+        case RTOS_BENCH_SEMAPHORE:
+            lock = bench.semaphores[0];
+            // fall through
+        default: {
+            xSemaphoreTake(lock, portMAX_DELAY);
+            uint32_t take_us = elapsed_us(start);
+            uint64_t held = rtos_bench_time_us();
+            while (rtos_bench_time_us() - held < RTOS_BENCH_HOLD_US) {
+                // keep it long enough for the others to queue up
+            }
+            start = rtos_bench_time_us();
+            xSemaphoreGive(lock);
+            return take_us + elapsed_us(start);
+        }
+    }
+}
+
+static void worker_task(void *pvParameters) {
+    uint32_t worker = (uint32_t)(uintptr_t)pvParameters;
+    uint32_t *out = &samples_us[worker * bench.rounds];
+    wait_start();
+    for (uint32_t i = 0; i < bench.rounds; i++) {
+        out[i] = contend();
+    }
+    finish();
+}
+
+// Takes the workers' notifications
+static void sink_task(void *pvParameters) {
+    wait_start();
+    uint32_t expected = RTOS_BENCH_WORKERS * bench.rounds;
+    for (uint32_t received = 0; received < expected;) {
+        received += task_signal_take(&bench.signals[SINK], portMAX_DELAY);
+    }
+    finish();
+}
+
+static UBaseType_t task_priority(const rtos_bench_case_t *c, int task, UBaseType_t top) {
+    if (c->priorities == RTOS_BENCH_EQUAL || task == SINK) {
+        return top;
+    }
+    if (c->scenario == RTOS_BENCH_PING_PONG) {
+        return task == PONG ? top : top - 1;  // the answer preempts the question
+    }
+    return top - task;
+}
+
+static void pin(TaskHandle_t task, int core) {
+#if RTOS_BENCH_CORES > 1
+    vTaskCoreAffinitySet(task, 1 << core);
+#endif
+}
+
+static bool create_primitives(const rtos_bench_case_t *c) {
+    memset(bench.queues, 0, sizeof(bench.queues));
+    memset(bench.semaphores, 0, sizeof(bench.semaphores));
+    bench.mutex = NULL;
+    int sides = c->scenario == RTOS_BENCH_PING_PONG ? 2 : 1;
+    for (int side = 0; side < sides; side++) {
+        switch (c->primitive) {
+            case RTOS_BENCH_QUEUE:
+                bench.queues[side] = xQueueCreate(sides == 2 ? 1 : RTOS_BENCH_WORKERS, sizeof(uint32_t));
+                if (bench.queues[side] == NULL) {
+                    return false;
+                }
+                break;
+            case RTOS_BENCH_SEMAPHORE:
+                bench.semaphores[side] = xSemaphoreCreateBinary();
+                if (bench.semaphores[side] == NULL) {
+                    return false;
+                }
+                if (sides == 1) {
+                    xSemaphoreGive(bench.semaphores[side]);  // used as a lock, starts free
+                }
+                break;
+            case RTOS_BENCH_MUTEX:
+                bench.mutex = xSemaphoreCreateMutex();
+                return bench.mutex != NULL;
+            default:
+                break;  // task notifications need nothing
+        }
+    }
+    return true;
+}
+
+static void delete_primitives(void) {
+    for (int side = 0; side < 2; side++) {
+        if (bench.queues[side] != NULL) {
+            vQueueDelete(bench.queues[side]);
+        }
+        if (bench.semaphores[side] != NULL) {
+            vSemaphoreDelete(bench.semaphores[side]);
+        }
+    }
+    if (bench.mutex != NULL) {
+        vSemaphoreDelete(bench.mutex);
+    }
+}
+
+static int compare_u32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return x < y ? -1 : x > y;
+}
+
+static void summarize(uint32_t samples, uint64_t wall_us, rtos_bench_result_t *result) {
+    qsort(samples_us, samples, sizeof(samples_us[0]), compare_u32);
+    result->samples = samples;
+    result->min_us = samples_us[0];
+    result->median_us = samples_us[samples / 2];
+    result->p99_us = samples_us[samples * 99 / 100];
+    result->max_us = samples_us[samples - 1];
+    result->ops_per_s = wall_us > 0 ? (uint32_t)((uint64_t)samples * 1000000 / wall_us) : 0;
+}
+
+bool rtos_bench_run(const rtos_bench_case_t *bench_case, uint32_t samples, UBaseType_t priority,
+                    rtos_bench_result_t *result) {
+    memset(result, 0, sizeof(*result));
+    bool ping_pong = bench_case->scenario == RTOS_BENCH_PING_PONG;
+    if ((bench_case->placement == RTOS_BENCH_CROSS_CORE && RTOS_BENCH_CORES < 2) ||
+        (ping_pong && bench_case->primitive == RTOS_BENCH_MUTEX)) {
+        return false;  // only the holder may give a mutex back, it cannot be passed to and fro
+    }
+    configASSERT(priority > RTOS_BENCH_WORKERS + 1);
+
+    samples = samples < RTOS_BENCH_MAX_SAMPLES ? samples : RTOS_BENCH_MAX_SAMPLES;
+    bench.primitive = bench_case->primitive;
+    bench.rounds = ping_pong ? samples : samples / RTOS_BENCH_WORKERS;
+    if (bench.rounds == 0 || !create_primitives(bench_case)) {
+        delete_primitives();
+        return false;
+    }
+
+    int tasks = ping_pong ? 2 : RTOS_BENCH_WORKERS + (bench_case->primitive == RTOS_BENCH_NOTIFY);
+    TaskHandle_t handles[MAX_TASKS] = {NULL};
+    bool created = true;
+    task_signal_init(&bench.done, NULL);
+    for (int task = 0; task < tasks && created; task++) {
+        TaskFunction_t run = ping_pong ? (task == PING ? ping_task : pong_task) : (task == SINK ? sink_task : worker_task);
+        created = xTaskCreate(run, "BENCH", configMINIMAL_STACK_SIZE, (void *)(uintptr_t)task,
+                              task_priority(bench_case, task, priority - 1), &handles[task]) == pdPASS;
+        if (created) {
+            pin(handles[task], bench_case->placement == RTOS_BENCH_CROSS_CORE ? task % 2 : 0);
+            task_signal_init(&bench.signals[task], handles[task]);
+        }
+    }
+
+    uint64_t start = rtos_bench_time_us();
+    uint32_t finished = 0;
+    if (created) {
+        for (int task = 0; task < tasks; task++) {
+            xTaskNotifyGive(handles[task]);  // they wait for this before doing anything
+        }
+        while (finished < (uint32_t)tasks) {
+            finished += task_signal_take(&bench.done, portMAX_DELAY);
+        }
+    }
+    uint64_t end = rtos_bench_time_us();
+
+    for (int task = 0; task < tasks; task++) {
+        if (handles[task] != NULL) {
+            vTaskDelete(handles[task]);
+        }
+    }
+    delete_primitives();
+    if (!created) {
+        return false;
+    }
+
+    if (ping_pong) {
+        summarize(bench.rounds, bench.end_us - bench.start_us, result);
+    } else {
+        summarize(bench.rounds * RTOS_BENCH_WORKERS, end - start, result);
+    }
+    return true;
+}
+
+void rtos_bench_run_all(uint32_t samples, UBaseType_t priority) {
+    printf("%-10s %-9s %-10s %-9s %7s %7s %7s %7s %9s\n", "scenario", "primitive", "placement", "priority",
+           "min us", "med us", "p99 us", "max us", "ops/s");
+
+    rtos_bench_case_t c;
+    for (c.scenario = 0; c.scenario < RTOS_BENCH_SCENARIOS; c.scenario++) {
+        for (c.primitive = 0; c.primitive < RTOS_BENCH_PRIMITIVES; c.primitive++) {
+            for (c.placement = 0; c.placement < RTOS_BENCH_PLACEMENTS; c.placement++) {
+                for (c.priorities = 0; c.priorities < RTOS_BENCH_PRIORITY_MODES; c.priorities++) {
+                    rtos_bench_result_t r;
+                    if (!rtos_bench_run(&c, samples, priority, &r)) {
+                        continue;
+                    }
+                    printf("%-10s %-9s %-10s %-9s %7lu %7lu %7lu %7lu %9lu\n", scenario_names[c.scenario],
+                           primitive_names[c.primitive], placement_names[c.placement], priority_names[c.priorities],
+                           (unsigned long)r.min_us, (unsigned long)r.median_us, (unsigned long)r.p99_us,
+                           (unsigned long)r.max_us, (unsigned long)r.ops_per_s);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+/**
+ * Latency and throughput benchmarks of the FreeRTOS primitives.
+ *
+ * Two scenarios:
+ *
+ *     ping-pong   two tasks signal each other back and forth, a sample is one round trip
+ *     contention  RTOS_BENCH_WORKERS tasks hammer one primitive, a sample is one operation
+ *
+ * each run on a queue, a binary semaphore, a mutex and a task notification
+ * (task_signal.h), with all tasks on one core or spread over both, and with equal
+ * or staggered priorities. A case reports min / median / p99 / max latency in us
+ * and the operations per second.
+ *
+ * In contention a worker's operation is send + receive on a shared queue,
+ * take + give of the shared semaphore or mutex (held for RTOS_BENCH_HOLD_US, not
+ * counted), or a give to one notified sink task.
+ *
+ * Only the FreeRTOS API and rtos_bench_time_us are used, so the same suite runs
+ * on the Pico (rtos_bench_rp2040.c, time_us_64) and on the FreeRTOS POSIX port
+ * (rtos_bench_host.c, see bench/host). Host numbers are only good for comparing
+ * primitives with one another, there every task is a Linux thread.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#if defined(configNUM_CORES) && configNUM_CORES > 1 && configUSE_CORE_AFFINITY
+#define RTOS_BENCH_CORES configNUM_CORES
+#else
+#define RTOS_BENCH_CORES 1  // cross core cases are skipped
+#endif
+
+#define RTOS_BENCH_WORKERS 3        // Tasks competing in the contention cases
+#define RTOS_BENCH_MAX_SAMPLES 1000  // Samples a case can keep
+#define RTOS_BENCH_WARMUP 16         // Round trips not timed at the start of a ping-pong case
+#define RTOS_BENCH_HOLD_US 5         // How long a contention worker keeps a semaphore or mutex
+
+typedef enum { RTOS_BENCH_PING_PONG, RTOS_BENCH_CONTENTION, RTOS_BENCH_SCENARIOS } rtos_bench_scenario_t;
+
+typedef enum {
+    RTOS_BENCH_QUEUE,
+    RTOS_BENCH_SEMAPHORE,
+    RTOS_BENCH_MUTEX,
+    RTOS_BENCH_NOTIFY,
+    RTOS_BENCH_PRIMITIVES
+} rtos_bench_primitive_t;
+
+typedef enum {
+    RTOS_BENCH_SAME_CORE,   // < every task on core 0
+    RTOS_BENCH_CROSS_CORE,  // < ping and pong on different cores, workers alternate
+    RTOS_BENCH_PLACEMENTS
+} rtos_bench_placement_t;
+
+typedef enum {
+    RTOS_BENCH_EQUAL,      // < every task at the same priority
+    RTOS_BENCH_STAGGERED,  // < pong above ping, each worker below the one before
+    RTOS_BENCH_PRIORITY_MODES
+} rtos_bench_priorities_t;
+
+typedef struct {
+    rtos_bench_scenario_t scenario;
+    rtos_bench_primitive_t primitive;
+    rtos_bench_placement_t placement;
+    rtos_bench_priorities_t priorities;
+} rtos_bench_case_t;
+
+typedef struct {
+    uint32_t samples;
+    uint32_t min_us;
+    uint32_t median_us;
+    uint32_t p99_us;
+    uint32_t max_us;
+    uint32_t ops_per_s;  // < round trips or operations per second, over all tasks
+} rtos_bench_result_t;
+
+/// @brief Microsecond clock of the platform (rtos_bench_rp2040.c or rtos_bench_host.c)
+uint64_t rtos_bench_time_us(void);
+
+/// @brief Run one case, blocks the calling task until it is done
+/// The benchmark tasks run below priority, which must be above RTOS_BENCH_WORKERS + 1.
+/// Notification slot TASK_SIGNAL_NOTIFY_INDEX of the calling task is used.
+/// @return false if the case does not apply here (cross core on one core, ping-pong on a mutex)
+/// or its tasks could not be created
+bool rtos_bench_run(const rtos_bench_case_t *bench_case, uint32_t samples, UBaseType_t priority,
+                    rtos_bench_result_t *result);
+
+/// @brief Run every case that applies and print a table, same rules as rtos_bench_run
+void rtos_bench_run_all(uint32_t samples, UBaseType_t priority);
@@ -0,0 +1,9 @@
+#include <time.h>
+
+#include "rtos_bench.h"
+
+uint64_t rtos_bench_time_us(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_nsec / 1000;
+}
@@ -0,0 +1,7 @@
+#include <pico/time.h>
+
+#include "rtos_bench.h"
+
+uint64_t rtos_bench_time_us(void) {
+    return time_us_64();
+}
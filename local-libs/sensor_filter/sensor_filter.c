@@ -0,0 +1,257 @@
+#include "sensor_filter.h"
+
+#include <stddef.h>
+
+// Rounded division of a signed sum by a positive count, halves away from zero
+static int32_t mean(int64_t sum, int32_t count) {
+    return (int32_t)(sum >= 0 ? (sum + count / 2) / count : (sum - count / 2) / count);
+}
+
+/* Moving average */
+
+static bool mavg_process(sensor_filter_stage_t *stage, int32_t in, int32_t *out) {
+    sensor_filter_mavg_t *f = (sensor_filter_mavg_t *)stage;
+    if (f->count == f->len) {
+        f->sum -= f->window[f->pos];
+    } else {
+        f->count++;
+    }
+    f->window[f->pos] = in;
+    f->sum += in;
+    f->pos = f->pos + 1 == f->len ? 0 : f->pos + 1;
+
+    *out = mean(f->sum, f->count);
+    return true;
+}
+
+static void mavg_reset(sensor_filter_stage_t *stage) {
+    sensor_filter_mavg_t *f = (sensor_filter_mavg_t *)stage;
+    f->pos = 0;
+    f->count = 0;
+    f->sum = 0;
+}
+
+static const sensor_filter_ops_t mavg_ops = {
+    .process = mavg_process,
+    .reset = mavg_reset,
+};
+
+sensor_filter_stage_t *sensor_filter_mavg_init(sensor_filter_mavg_t *f, uint16_t len) {
+    if (len == 0 || len > SENSOR_FILTER_MAVG_MAX) {
+        return NULL;
+    }
+    f->stage.ops = &mavg_ops;
+    f->stage.next = NULL;
+    f->len = len;
+    mavg_reset(&f->stage);
+    return &f->stage;
+}
+
+/* Median */
+
+static bool median_process(sensor_filter_stage_t *stage, int32_t in, int32_t *out) {
+    sensor_filter_median_t *f = (sensor_filter_median_t *)stage;
+    uint8_t n = f->count;
+
+    // take the oldest sample out of the sorted copy
+    if (n == f->len) {
+        int32_t old = f->window[f->pos];
+        uint8_t i = 0;
+        while (f->sorted[i] != old) {
+            i++;
+        }
+        for (; i + 1 < n; i++) {
+            f->sorted[i] = f->sorted[i + 1];
+        }
+        n--;
+    }
+
+    // and put the new one in its place
+    uint8_t i = n;
+    while (i > 0 && f->sorted[i - 1] > in) {
+        f->sorted[i] = f->sorted[i - 1];
+        i--;
+    }
+    f->sorted[i] = in;
+    f->count = n + 1;
+
+    f->window[f->pos] = in;
+    f->pos = f->pos + 1 == f->len ? 0 : f->pos + 1;
+
+    *out = f->sorted[f->count / 2];
+    return true;
+}
+
+static void median_reset(sensor_filter_stage_t *stage) {
+    sensor_filter_median_t *f = (sensor_filter_median_t *)stage;
+    f->pos = 0;
+    f->count = 0;
+}
+
+static const sensor_filter_ops_t median_ops = {
+    .process = median_process,
+    .reset = median_reset,
+};
+
+sensor_filter_stage_t *sensor_filter_median_init(sensor_filter_median_t *f, uint8_t len) {
+    if (len == 0 || len > SENSOR_FILTER_MEDIAN_MAX) {
+        return NULL;
+    }
+    f->stage.ops = &median_ops;
+    f->stage.next = NULL;
+    f->len = len;
+    median_reset(&f->stage);
+    return &f->stage;
+}
+
+/* Exponential moving average */
+
+static bool ema_process(sensor_filter_stage_t *stage, int32_t in, int32_t *out) {
+    sensor_filter_ema_t *f = (sensor_filter_ema_t *)stage;
+    int64_t x = (int64_t)in * ((int64_t)1 << f->shift);
+    int64_t half = f->shift ? (int64_t)1 << (f->shift - 1) : 0;
+    if (!f->primed) {
+        f->acc = x;  // start at the first sample instead of ramping up from 0
+        f->primed = true;
+    } else {
+        // the step rounds to nearest, halves away from zero: a floored step stops up to
+        // a whole count short of a steady input coming from below
+        int64_t diff = x - f->acc;
+        f->acc += diff >= 0 ? (diff + half) >> f->shift : -((-diff + half) >> f->shift);
+    }
+
+    *out = (int32_t)((f->acc + half) >> f->shift);
+    return true;
+}
+
+static void ema_reset(sensor_filter_stage_t *stage) {
+    sensor_filter_ema_t *f = (sensor_filter_ema_t *)stage;
+    f->acc = 0;
+    f->primed = false;
+}
+
+static const sensor_filter_ops_t ema_ops = {
+    .process = ema_process,
+    .reset = ema_reset,
+};
+
+sensor_filter_stage_t *sensor_filter_ema_init(sensor_filter_ema_t *f, uint8_t shift) {
+    if (shift > 16) {
+        return NULL;
+    }
+    f->stage.ops = &ema_ops;
+    f->stage.next = NULL;
+    f->shift = shift;
+    ema_reset(&f->stage);
+    return &f->stage;
+}
+
+/* Outlier rejection */
+
+static bool outlier_process(sensor_filter_stage_t *stage, int32_t in, int32_t *out) {
+    sensor_filter_outlier_t *f = (sensor_filter_outlier_t *)stage;
+    int64_t step = (int64_t)in - f->last;
+    if (f->primed && (step > f->threshold || -step > f->threshold) && f->rejects < f->max_rejects) {
+        f->rejects++;
+        f->rejected++;
+        return false;
+    }
+
+    f->primed = true;
+    f->rejects = 0;
+    f->last = in;
+    *out = in;
+    return true;
+}
+
+static void outlier_reset(sensor_filter_stage_t *stage) {
+    sensor_filter_outlier_t *f = (sensor_filter_outlier_t *)stage;
+    f->primed = false;
+    f->rejects = 0;
+    f->last = 0;
+}
+
+static const sensor_filter_ops_t outlier_ops = {
+    .process = outlier_process,
+    .reset = outlier_reset,
+};
+
+sensor_filter_stage_t *sensor_filter_outlier_init(sensor_filter_outlier_t *f, int32_t threshold, uint8_t max_rejects) {
+    if (threshold < 0) {
+        return NULL;
+    }
+    f->stage.ops = &outlier_ops;
+    f->stage.next = NULL;
+    f->threshold = threshold;
+    f->max_rejects = max_rejects;
+    f->rejected = 0;
+    outlier_reset(&f->stage);
+    return &f->stage;
+}
+
+/* Decimation */
+
+static bool decimate_process(sensor_filter_stage_t *stage, int32_t in, int32_t *out) {
+    sensor_filter_decimate_t *f = (sensor_filter_decimate_t *)stage;
+    f->sum += in;
+    if (++f->count < f->factor) {
+        return false;
+    }
+
+    *out = mean(f->sum, f->factor);
+    f->sum = 0;
+    f->count = 0;
+    return true;
+}
+
+static void decimate_reset(sensor_filter_stage_t *stage) {
+    sensor_filter_decimate_t *f = (sensor_filter_decimate_t *)stage;
+    f->count = 0;
+    f->sum = 0;
+}
+
+static const sensor_filter_ops_t decimate_ops = {
+    .process = decimate_process,
+    .reset = decimate_reset,
+};
+
+sensor_filter_stage_t *sensor_filter_decimate_init(sensor_filter_decimate_t *f, uint16_t factor) {
+    if (factor == 0) {
+        return NULL;
+    }
+    f->stage.ops = &decimate_ops;
+    f->stage.next = NULL;
+    f->factor = factor;
+    decimate_reset(&f->stage);
+    return &f->stage;
+}
+
+/* Chains */
+
+sensor_filter_stage_t *sensor_filter_chain(sensor_filter_stage_t **stages, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        if (stages[i] == NULL) {
+            return NULL;
+        }
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        stages[i]->next = i + 1 < count ? stages[i + 1] : NULL;
+    }
+    return count ? stages[0] : NULL;
+}
+
+bool sensor_filter_run(sensor_filter_stage_t *first, int32_t in, int32_t *out) {
+    for (sensor_filter_stage_t *s = first; s != NULL; s = s->next) {
+        if (!s->ops->process(s, in, &in)) {
+            return false;
+        }
+    }
+    *out = in;
+    return true;
+}
+
+void sensor_filter_reset(sensor_filter_stage_t *first) {
+    for (sensor_filter_stage_t *s = first; s != NULL; s = s->next) {
+        s->ops->reset(s);
+    }
+}
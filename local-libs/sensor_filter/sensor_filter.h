@@ -0,0 +1,117 @@
+#pragma once
+
+/**
+ * Streaming filters for sensor samples.
+ *
+ * Every stage takes one integer sample at a time and either produces one or
+ * swallows it (decimation, outlier rejection). Stages are chained through their
+ * next pointer and run in order, so a channel can use e.g.
+ *
+ *     outlier -> median -> ema -> decimate
+ *
+ * Nothing is allocated: each stage is a struct the caller owns, windows live
+ * inside the stage. The work per sample does not grow with the window length,
+ * except for the median which is O(N) in its (small, bounded) window.
+ *
+ * Samples are plain int32_t in whatever unit the channel uses.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SENSOR_FILTER_MAVG_MAX 64    // Longest moving average window
+#define SENSOR_FILTER_MEDIAN_MAX 15  // Longest median window
+
+typedef struct sensor_filter_stage sensor_filter_stage_t;
+
+/// @brief What a stage implements
+typedef struct {
+    /// Feed one sample, return true and set out if the stage produces one
+    bool (*process)(sensor_filter_stage_t *stage, int32_t in, int32_t *out);
+    /// Forget all history
+    void (*reset)(sensor_filter_stage_t *stage);
+} sensor_filter_ops_t;
+
+/// @brief Common head of every stage
+struct sensor_filter_stage {
+    const sensor_filter_ops_t *ops;
+    sensor_filter_stage_t *next;  // < stage fed with this one's output, NULL at the end
+};
+
+/// @brief Mean of the last len samples
+typedef struct {
+    sensor_filter_stage_t stage;
+    int32_t window[SENSOR_FILTER_MAVG_MAX];
+    uint16_t len;    // < window length
+    uint16_t pos;    // < slot the next sample replaces
+    uint16_t count;  // < samples in the window, less than len while filling up
+    int64_t sum;     // < running sum of the window
+} sensor_filter_mavg_t;
+
+/// @brief Median of the last len samples
+typedef struct {
+    sensor_filter_stage_t stage;
+    int32_t window[SENSOR_FILTER_MEDIAN_MAX];  // < arrival order
+    int32_t sorted[SENSOR_FILTER_MEDIAN_MAX];  // < same samples, ascending
+    uint8_t len;
+    uint8_t pos;
+    uint8_t count;
+} sensor_filter_median_t;
+
+/// @brief Exponential moving average, y += (x - y) / 2^shift
+typedef struct {
+    sensor_filter_stage_t stage;
+    int64_t acc;    // < output scaled by 2^shift, keeps the bits the shift would drop
+    uint8_t shift;
+    bool primed;    // < first sample seen
+} sensor_filter_ema_t;
+
+/// @brief Drops samples further than threshold from the last accepted one
+typedef struct {
+    sensor_filter_stage_t stage;
+    int32_t threshold;     // < largest accepted step
+    uint8_t max_rejects;   // < accept anyway after this many rejections in a row (a real step)
+    uint8_t rejects;       // < rejections in a row so far
+    bool primed;
+    int32_t last;          // < last accepted sample
+    uint32_t rejected;     // < total samples dropped
+} sensor_filter_outlier_t;
+
+/// @brief Emits the mean of every factor samples
+typedef struct {
+    sensor_filter_stage_t stage;
+    uint16_t factor;
+    uint16_t count;
+    int64_t sum;
+} sensor_filter_decimate_t;
+
+/// @brief Start a moving average over len samples (1 to SENSOR_FILTER_MAVG_MAX)
+/// @return the stage, or NULL if len is out of range
+sensor_filter_stage_t *sensor_filter_mavg_init(sensor_filter_mavg_t *f, uint16_t len);
+
+/// @brief Start a median over len samples (1 to SENSOR_FILTER_MEDIAN_MAX, odd lengths are usual)
+/// @return the stage, or NULL if len is out of range
+sensor_filter_stage_t *sensor_filter_median_init(sensor_filter_median_t *f, uint8_t len);
+
+/// @brief Start an EMA with alpha = 1 / 2^shift (shift up to 16)
+/// @return the stage, or NULL if shift is out of range
+sensor_filter_stage_t *sensor_filter_ema_init(sensor_filter_ema_t *f, uint8_t shift);
+
+/// @brief Start outlier rejection
+/// @return the stage, or NULL if threshold is negative
+sensor_filter_stage_t *sensor_filter_outlier_init(sensor_filter_outlier_t *f, int32_t threshold, uint8_t max_rejects);
+
+/// @brief Start a decimator by factor (1 or more)
+/// @return the stage, or NULL if factor is 0
+sensor_filter_stage_t *sensor_filter_decimate_init(sensor_filter_decimate_t *f, uint16_t factor);
+
+/// @brief Link stages in the order given into a chain
+/// @return the first stage, or NULL if any of them is NULL (e.g. a failed init)
+sensor_filter_stage_t *sensor_filter_chain(sensor_filter_stage_t **stages, uint8_t count);
+
+/// @brief Feed a sample through a chain
+/// @return true and out set if the sample made it through every stage
+bool sensor_filter_run(sensor_filter_stage_t *first, int32_t in, int32_t *out);
+
+/// @brief Reset every stage of a chain
+void sensor_filter_reset(sensor_filter_stage_t *first);
@@ -0,0 +1,88 @@
+#pragma once
+/**
+ * Integer sensor conversions for the RP2040.
+ *
+ * The Cortex-M0+ cores have no FPU, so every float operation is a library call.
+ * Everything here stays in 32-bit integers (divisions go to the SIO divider).
+ *
+ * Units used across the firmware:
+ * - ADC voltage:  microvolts in Q7 (uV * 128), exact for every 12-bit code
+ * - voltage:      millivolts
+ * - temperature:  centi-degrees C for the die sensor, deci-degrees C for the AM2320
+ * - humidity:     deci-percent RH
+ *
+ * Every conversion returns the float formula's result rounded to nearest (half up),
+ * computed exactly rather than approximated.
+ */
+
+#include <stdint.h>
+
+#define SENSOR_FIXED_ADC_VREF_MV 3300  // ADC reference voltage
+#define SENSOR_FIXED_ADC_BITS 12       // ADC resolution
+
+// One ADC count in Q7 microvolts: 3300000 / 4096 * 128 = 103125 (no rounding error)
+#define SENSOR_FIXED_UV_Q7_PER_COUNT ((SENSOR_FIXED_ADC_VREF_MV * 1000 * 128) >> SENSOR_FIXED_ADC_BITS)
+
+// Die temperature sensor (RP2040 datasheet): T = 27 - (V - 0.706) / 0.001721
+#define SENSOR_FIXED_DIE_V27_UV 706000  // Sensor voltage at 27 C
+#define SENSOR_FIXED_DIE_SLOPE_UV 1721  // Sensor slope per degree C (negative)
+
+// Divides num by den (den > 0) rounding to nearest, halves go up like floor(x + 0.5)
+static inline int32_t sensor_fixed_div_round(int32_t num, int32_t den) {
+    int32_t q = num / den;
+    int32_t r = num % den;
+    if (r < 0) {  // C truncates toward zero, we want floor
+        q--;
+        r += den;
+    }
+    return q + (2 * r >= den);
+}
+
+// Raw ADC counts to Q7 microvolts
+static inline int32_t sensor_fixed_adc_to_uv_q7(uint16_t counts) {
+    return (int32_t)counts * SENSOR_FIXED_UV_Q7_PER_COUNT;
+}
+
+// Oversampled ADC value with extra_bits (at most 15) more than a raw sample to Q7
+// microvolts, the fraction of a count rounded to nearest like everything else here
+static inline int32_t sensor_fixed_adc_oversampled_to_uv_q7(uint32_t value, uint8_t extra_bits) {
+    if (extra_bits == 0) {
+        return (int32_t)(value * SENSOR_FIXED_UV_Q7_PER_COUNT);
+    }
+    // value * 103125 would overflow, so scale the whole counts and the fraction apart
+    uint32_t counts = value >> extra_bits;
+    uint32_t fraction = value & ((1u << extra_bits) - 1);
+    return (int32_t)(counts * SENSOR_FIXED_UV_Q7_PER_COUNT +
+                     ((fraction * SENSOR_FIXED_UV_Q7_PER_COUNT + (1u << (extra_bits - 1))) >> extra_bits));
+}
+
+// Q7 microvolts to millivolts
+static inline int32_t sensor_fixed_uv_q7_to_mv(int32_t uv_q7) {
+    return sensor_fixed_div_round(uv_q7, 1000 * 128);
+}
+
+// Q7 microvolts from the die sensor to centi-degrees C
+static inline int32_t sensor_fixed_die_temp_centi_c(int32_t uv_q7) {
+    // 100 * (V27 - V) / slope with both sides in Q7 microvolts. The product would
+    // overflow 32 bits, so divide first and scale the remainder separately.
+    const int32_t den = SENSOR_FIXED_DIE_SLOPE_UV * 128 / 4;  // 100 / den reduced by 4
+    int32_t delta = SENSOR_FIXED_DIE_V27_UV * 128 - uv_q7;
+    int32_t q = delta / den;
+    int32_t r = delta % den;
+    if (r < 0) {
+        q--;
+        r += den;
+    }
+    return 2700 + 25 * q + sensor_fixed_div_round(25 * r, den);
+}
+
+// AM2320 temperature word (sign-magnitude, bit 15 is the sign) to deci-degrees C
+static inline int16_t sensor_fixed_am2320_temp_deci_c(uint16_t raw) {
+    int16_t magnitude = (int16_t)(raw & 0x7FFF);
+    return (raw & 0x8000) ? -magnitude : magnitude;
+}
+
+// AM2320 humidity word to deci-percent RH (the sensor already reports tenths)
+static inline uint16_t sensor_fixed_am2320_hum_deci_pct(uint16_t raw) {
+    return raw;
+}
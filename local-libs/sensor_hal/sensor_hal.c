@@ -0,0 +1,62 @@
+#include "sensor_hal.h"
+
+#include <string.h>
+
+static void (*ready_hook)(void *user) = NULL;
+static void *ready_user = NULL;
+
+int sensor_hal_find(const char *name) {
+    for (uint8_t i = 0; i < sensor_registry_count; i++) {
+        if (strcmp(sensor_registry[i]->name, name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+sensor_status_t sensor_hal_check(const sensor_driver_t *driver, const int32_t *values) {
+    for (uint8_t i = 0; i < driver->values; i++) {
+        if (values[i] < driver->value[i].min || values[i] > driver->value[i].max) {
+            return SENSOR_ERR_RANGE;
+        }
+    }
+    return SENSOR_OK;
+}
+
+uint8_t sensor_unit_decimals(sensor_unit_t unit) {
+    switch (unit) {
+        case SENSOR_UNIT_CENTI_C:
+            return 2;
+        case SENSOR_UNIT_DECI_C:
+        case SENSOR_UNIT_DECI_PCT_RH:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+const char *sensor_unit_symbol(sensor_unit_t unit) {
+    switch (unit) {
+        case SENSOR_UNIT_CENTI_C:
+        case SENSOR_UNIT_DECI_C:
+            return "C";
+        case SENSOR_UNIT_DECI_PCT_RH:
+            return "%RH";
+        case SENSOR_UNIT_MV:
+            return "mV";
+        default:
+            return "";
+    }
+}
+
+void sensor_hal_set_ready_hook(void (*hook)(void *user), void *user) {
+    ready_user = user;
+    ready_hook = hook;
+}
+
+void sensor_hal_ready(void) {
+    void (*hook)(void *user) = ready_hook;
+    if (hook != NULL) {
+        hook(ready_user);
+    }
+}
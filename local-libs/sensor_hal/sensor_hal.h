@@ -0,0 +1,95 @@
+#pragma once
+
+/**
+ * Sensor HAL.
+ *
+ * A driver describes its sensor (values, units, valid ranges, how often it may
+ * and should be sampled) and implements four calls:
+ *
+ *     init   set the hardware up, once
+ *     start  begin a measurement, never blocks
+ *     poll   SENSOR_PENDING while it runs, then its status
+ *     read   the values and time of the measurement poll reported done
+ *
+ * Because start does not block, a caller can start every sensor that is due
+ * and collect them afterwards: their bus transfers queue up and interleave on
+ * the i2c_bus and their conversion waits overlap instead of adding up. A driver
+ * finishing from an interrupt calls sensor_hal_ready so the caller does not have
+ * to poll in a loop.
+ *
+ * The drivers built into the firmware are listed at compile time in
+ * sensor_registry (sensor_registry.c), selected with the SENSOR_HAL_* options
+ * in src/CMakeLists.txt. Code that wants every sensor iterates the registry.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define SENSOR_HAL_MAX_VALUES 2  // Values one measurement gives (e.g. temperature and humidity)
+
+typedef enum {
+    SENSOR_OK = 0,
+    SENSOR_PENDING = 1,       // < measurement still running (poll only)
+    SENSOR_ERR_BUS = -1,      // < the device did not acknowledge
+    SENSOR_ERR_FRAME = -2,    // < malformed reply
+    SENSOR_ERR_CRC = -3,      // < reply checksum mismatch
+    SENSOR_ERR_BUSY = -4,     // < a measurement is already running
+    SENSOR_ERR_TIMEOUT = -5,  // < the measurement did not complete within timeout_ms
+    SENSOR_ERR_RANGE = -6,    // < a value is outside the part's range
+    SENSOR_ERR_NO_DATA = -7,  // < nothing measured yet
+    SENSOR_ERR_INIT = -8,     // < the hardware could not be set up
+} sensor_status_t;
+
+typedef enum {
+    SENSOR_UNIT_CENTI_C,      // < hundredths of a degree C
+    SENSOR_UNIT_DECI_C,       // < tenths of a degree C
+    SENSOR_UNIT_DECI_PCT_RH,  // < tenths of a percent relative humidity
+    SENSOR_UNIT_MV,           // < millivolts
+} sensor_unit_t;
+
+typedef struct {
+    const char *name;
+    sensor_unit_t unit;
+    int32_t min;  // < smallest valid value
+    int32_t max;  // < largest valid value
+} sensor_value_info_t;
+
+typedef struct {
+    const char *name;
+    uint8_t values;                                   // < values per measurement
+    sensor_value_info_t value[SENSOR_HAL_MAX_VALUES];
+    uint32_t min_period_ms;  // < measurements never start closer together than this
+    uint32_t period_ms;      // < usual time between measurements
+    uint32_t timeout_ms;     // < a measurement still pending after this long has failed
+
+    sensor_status_t (*init)(void *ctx);
+    sensor_status_t (*start)(void *ctx);
+    sensor_status_t (*poll)(void *ctx);
+    sensor_status_t (*read)(void *ctx, int32_t *values, uint64_t *time_us);
+    void *ctx;  // < passed to the calls, lets one implementation back several entries
+} sensor_driver_t;
+
+/// @brief The drivers built in, see sensor_registry.c
+extern const sensor_driver_t *const sensor_registry[];
+extern const uint8_t sensor_registry_count;
+
+/// @brief Index of the registry entry called name
+/// @return -1 if there is none
+int sensor_hal_find(const char *name);
+
+/// @brief Check values against the driver's ranges
+/// @return SENSOR_OK or SENSOR_ERR_RANGE
+sensor_status_t sensor_hal_check(const sensor_driver_t *driver, const int32_t *values);
+
+/// @brief Decimal places of a unit (a value of 235 in SENSOR_UNIT_DECI_C is 23.5)
+uint8_t sensor_unit_decimals(sensor_unit_t unit);
+
+/// @brief Symbol to print after a value, e.g. "C" or "%RH"
+const char *sensor_unit_symbol(sensor_unit_t unit);
+
+/// @brief Whoever polls the drivers registers a hook to be woken when one completes
+void sensor_hal_set_ready_hook(void (*hook)(void *user), void *user);
+
+/// @brief Driver side: a measurement completed, safe from interrupts on either core
+void sensor_hal_ready(void);
@@ -0,0 +1,94 @@
+#include "sensor_hal_am2320.h"
+
+#include "am2320.h"
+#include "am2320_async_rp2040.h"
+#include "i2c_bus_rp2040.h"
+
+typedef struct {
+    i2c_bus_t bus;
+    am2320_async_t sensor;
+    am2320_result_t result;  // < of the last read, valid once done
+    volatile bool done;
+} am2320_hal_t;
+
+static am2320_hal_t am2320_hal;
+
+static sensor_status_t to_sensor_status(am2320_status_t status) {
+    switch (status) {
+        case AM2320_OK:
+            return SENSOR_OK;
+        case AM2320_ERR_FRAME:
+            return SENSOR_ERR_FRAME;
+        case AM2320_ERR_CRC:
+            return SENSOR_ERR_CRC;
+        case AM2320_ERR_BUSY:
+            return SENSOR_ERR_BUSY;
+        default:
+            return SENSOR_ERR_BUS;
+    }
+}
+
+static void on_result(void *user, const am2320_result_t *result) {
+    am2320_hal_t *hal = user;
+    hal->result = *result;
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);  // the result before the flag, the poller may be on the other core
+    hal->done = true;
+    sensor_hal_ready();
+}
+
+static sensor_status_t am2320_hal_init(void *ctx) {
+    am2320_hal_t *hal = ctx;
+    i2c_init(DEFAULT_I2C_PORT, 100 * 1000);  // the sensor is rated for 100 kHz
+    gpio_set_function(DEFAULT_SDA, GPIO_FUNC_I2C);
+    gpio_set_function(DEFAULT_SCL, GPIO_FUNC_I2C);
+    gpio_pull_up(DEFAULT_SDA);
+    gpio_pull_up(DEFAULT_SCL);
+    i2c_bus_rp2040_init(&hal->bus, DEFAULT_I2C_PORT);
+    am2320_async_rp2040_init(&hal->sensor, &hal->bus, AM2320_ADDRESS);
+    hal->done = false;
+    return SENSOR_OK;
+}
+
+static sensor_status_t am2320_hal_start(void *ctx) {
+    am2320_hal_t *hal = ctx;
+    if (am2320_async_busy(&hal->sensor)) {
+        return SENSOR_ERR_BUSY;  // a read that timed out is still going
+    }
+    hal->done = false;
+    return to_sensor_status(am2320_async_read(&hal->sensor, on_result, hal));
+}
+
+static sensor_status_t am2320_hal_poll(void *ctx) {
+    am2320_hal_t *hal = ctx;
+    return hal->done ? to_sensor_status(hal->result.status) : SENSOR_PENDING;
+}
+
+static sensor_status_t am2320_hal_read(void *ctx, int32_t *values, uint64_t *time_us) {
+    am2320_hal_t *hal = ctx;
+    if (!hal->done || hal->result.status != AM2320_OK) {
+        return SENSOR_ERR_NO_DATA;
+    }
+    values[SENSOR_AM2320_TEMP] = hal->result.temp;
+    values[SENSOR_AM2320_HUM] = hal->result.hum;
+    *time_us = hal->result.time_us;
+    return SENSOR_OK;
+}
+
+const sensor_driver_t sensor_hal_am2320 = {
+    .name = "am2320",
+    .values = 2,
+    .value =
+        {
+            // the rated range, the CRC already catches bus errors
+            [SENSOR_AM2320_TEMP] = {.name = "temp", .unit = SENSOR_UNIT_DECI_C, .min = -400, .max = 800},
+            [SENSOR_AM2320_HUM] = {.name = "humidity", .unit = SENSOR_UNIT_DECI_PCT_RH, .min = 0, .max = 1000},
+        },
+    .min_period_ms = AM2320_MIN_INTERVAL_MS,
+    .period_ms = 5000,
+    .timeout_ms = AM2320_READ_TIMEOUT_MS,
+    .init = am2320_hal_init,
+    .start = am2320_hal_start,
+    .poll = am2320_hal_poll,
+    .read = am2320_hal_read,
+    .ctx = &am2320_hal,
+};
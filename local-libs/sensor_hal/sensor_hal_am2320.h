@@ -0,0 +1,11 @@
+#pragma once
+
+#include "sensor_hal.h"
+
+// Values of an AM2320 measurement
+#define SENSOR_AM2320_TEMP 0  // deci-degrees C
+#define SENSOR_AM2320_HUM 1   // deci-percent RH
+
+/// @brief AM2320 on DEFAULT_I2C_PORT at DEFAULT_SDA / DEFAULT_SCL (am2320.h), read with the non-blocking driver
+/// The registry entry must be the only user of the sensor
+extern const sensor_driver_t sensor_hal_am2320;
@@ -0,0 +1,139 @@
+#include "sensor_hal_am2320_mux.h"
+
+#include "am2320.h"
+#include "am2320_mux_rp2040.h"
+#include "i2c_bus_rp2040.h"
+
+typedef struct {
+    i2c_bus_t bus;
+    am2320_mux_rp2040_t mux;
+    bool initialised;
+    am2320_result_t results[AM2320_MUX_CHANNELS];  // < of the last read done, by channel
+    uint32_t started;             // < reads started
+    volatile uint32_t completed;  // < reads done, results holds the last one
+    uint64_t started_us;          // < when the last read started
+} am2320_mux_hal_t;
+
+typedef struct {
+    uint8_t channel;
+    uint32_t read;  // < number of the read this entry's measurement comes from
+} am2320_mux_hal_channel_t;
+
+static am2320_mux_hal_t am2320_mux_hal;
+static am2320_mux_hal_channel_t am2320_mux_hal_channels[AM2320_MUX_CHANNELS] = {
+    {.channel = 0}, {.channel = 1}, {.channel = 2}, {.channel = 3},
+    {.channel = 4}, {.channel = 5}, {.channel = 6}, {.channel = 7},
+};
+
+static sensor_status_t to_sensor_status(am2320_status_t status) {
+    switch (status) {
+        case AM2320_OK:
+            return SENSOR_OK;
+        case AM2320_ERR_FRAME:
+            return SENSOR_ERR_FRAME;
+        case AM2320_ERR_CRC:
+            return SENSOR_ERR_CRC;
+        case AM2320_ERR_BUSY:
+            return SENSOR_ERR_BUSY;
+        default:
+            return SENSOR_ERR_BUS;
+    }
+}
+
+static void on_results(void *user, const am2320_result_t *results) {
+    am2320_mux_hal_t *hal = user;
+    for (uint8_t c = 0; c < AM2320_MUX_CHANNELS; c++) {
+        hal->results[c] = results[c];
+    }
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);  // the results before the count, the poller may be on the other core
+    hal->completed = hal->started;
+    sensor_hal_ready();
+}
+
+// Every entry calls it, the bus and the mux are set up by the first
+static sensor_status_t am2320_mux_hal_init(void *ctx) {
+    am2320_mux_hal_t *hal = &am2320_mux_hal;
+    if (hal->initialised) {
+        return SENSOR_OK;
+    }
+    i2c_init(DEFAULT_I2C_PORT, 100 * 1000);  // the sensors are rated for 100 kHz
+    gpio_set_function(DEFAULT_SDA, GPIO_FUNC_I2C);
+    gpio_set_function(DEFAULT_SCL, GPIO_FUNC_I2C);
+    gpio_pull_up(DEFAULT_SDA);
+    gpio_pull_up(DEFAULT_SCL);
+    i2c_bus_rp2040_init(&hal->bus, DEFAULT_I2C_PORT);
+    if (!am2320_mux_rp2040_init(&hal->mux, &hal->bus, TCA9548A_ADDRESS, SENSOR_HAL_AM2320_MUX)) {
+        return SENSOR_ERR_INIT;
+    }
+    hal->started = 0;
+    hal->completed = 0;
+    hal->initialised = true;
+    return SENSOR_OK;
+}
+
+static sensor_status_t am2320_mux_hal_start(void *ctx) {
+    am2320_mux_hal_t *hal = &am2320_mux_hal;
+    am2320_mux_hal_channel_t *ch = ctx;
+
+    if (am2320_mux_busy(&hal->mux.mux)) {
+        ch->read = hal->started;  // another entry's read covers this channel too
+        return SENSOR_OK;
+    }
+    uint64_t now = time_us_64();
+    if (hal->completed != 0 && now - hal->started_us < AM2320_MIN_INTERVAL_MS * 1000ull) {
+        ch->read = hal->completed;  // read moments ago, reading again would only warm the sensors up
+        return SENSOR_OK;
+    }
+
+    hal->started_us = now;
+    ch->read = ++hal->started;
+    am2320_status_t status = am2320_mux_read(&hal->mux.mux, on_results, hal);
+    if (status != AM2320_OK) {
+        ch->read = hal->completed;
+        hal->started = hal->completed;
+    }
+    return to_sensor_status(status);
+}
+
+static sensor_status_t am2320_mux_hal_poll(void *ctx) {
+    am2320_mux_hal_t *hal = &am2320_mux_hal;
+    am2320_mux_hal_channel_t *ch = ctx;
+    if ((int32_t)(hal->completed - ch->read) < 0 || hal->completed == 0) {
+        return SENSOR_PENDING;
+    }
+    return to_sensor_status(hal->results[ch->channel].status);
+}
+
+static sensor_status_t am2320_mux_hal_read(void *ctx, int32_t *values, uint64_t *time_us) {
+    am2320_mux_hal_t *hal = &am2320_mux_hal;
+    am2320_mux_hal_channel_t *ch = ctx;
+    const am2320_result_t *result = &hal->results[ch->channel];
+    if (am2320_mux_hal_poll(ctx) != SENSOR_OK) {
+        return SENSOR_ERR_NO_DATA;
+    }
+    values[SENSOR_AM2320_MUX_TEMP] = result->temp;
+    values[SENSOR_AM2320_MUX_HUM] = result->hum;
+    *time_us = result->time_us;
+    return SENSOR_OK;
+}
+
+#define AM2320_MUX_HAL_ENTRY(c)                                                                                  \
+    {                                                                                                            \
+        .name = "am2320_mux" #c,                                                                                 \
+        .values = 2,                                                                                             \
+        .value =                                                                                                 \
+            {                                                                                                    \
+                [SENSOR_AM2320_MUX_TEMP] = {.name = "temp", .unit = SENSOR_UNIT_DECI_C, .min = -400, .max = 800}, \
+                [SENSOR_AM2320_MUX_HUM] = {.name = "humidity", .unit = SENSOR_UNIT_DECI_PCT_RH, .min = 0,       \
+                                           .max = 1000},                                                         \
+            },                                                                                                   \
+        .min_period_ms = AM2320_MIN_INTERVAL_MS, .period_ms = 5000,                                              \
+        .timeout_ms = AM2320_READ_TIMEOUT_MS * AM2320_MUX_CHANNELS, .init = am2320_mux_hal_init,                \
+        .start = am2320_mux_hal_start, .poll = am2320_mux_hal_poll, .read = am2320_mux_hal_read,                 \
+        .ctx = &am2320_mux_hal_channels[c],                                                                      \
+    }
+
+const sensor_driver_t sensor_hal_am2320_mux[AM2320_MUX_CHANNELS] = {
+    AM2320_MUX_HAL_ENTRY(0), AM2320_MUX_HAL_ENTRY(1), AM2320_MUX_HAL_ENTRY(2), AM2320_MUX_HAL_ENTRY(3),
+    AM2320_MUX_HAL_ENTRY(4), AM2320_MUX_HAL_ENTRY(5), AM2320_MUX_HAL_ENTRY(6), AM2320_MUX_HAL_ENTRY(7),
+};
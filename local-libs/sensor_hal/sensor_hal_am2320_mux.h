@@ -0,0 +1,19 @@
+#pragma once
+
+#include "am2320_mux.h"
+#include "sensor_hal.h"
+
+// Values of a measurement, as for a single AM2320 (sensor_hal_am2320.h)
+#define SENSOR_AM2320_MUX_TEMP 0  // deci-degrees C
+#define SENSOR_AM2320_MUX_HUM 1   // deci-percent RH
+
+#ifndef SENSOR_HAL_AM2320_MUX
+#define SENSOR_HAL_AM2320_MUX 0  // Mux channels with an AM2320, bit per channel
+#endif
+
+/// @brief AM2320s behind a TCA9548A at TCA9548A_ADDRESS on DEFAULT_I2C_PORT (am2320.h), one entry per channel,
+/// named "am2320_mux0" to "am2320_mux7"
+/// The sensors on the channels in SENSOR_HAL_AM2320_MUX are read together with am2320_mux, so their waits
+/// overlap: starting one entry reads them all, and entries started while that read runs, or within
+/// AM2320_MIN_INTERVAL_MS of it, take their values from it
+extern const sensor_driver_t sensor_hal_am2320_mux[AM2320_MUX_CHANNELS];
@@ -0,0 +1,67 @@
+#include "sensor_hal_die_temp.h"
+
+#include "adc_sampler.h"
+#include "sensor_fixed.h"
+
+sensor_hal_die_temp_config_t sensor_hal_die_temp_config = {
+    .priority = tskIDLE_PRIORITY + 1,
+    .cores = 0,
+};
+
+static sensor_status_t die_temp_init(void *ctx) {
+    const sensor_hal_die_temp_config_t *config = ctx;
+    if (adc_sampler_inputs() == 0) {
+        // Nothing else started the ADC sampling service, convert the sensor alone
+        adc_sampler_config_t sampler = {
+            .input_mask = 1u << ADC_SAMPLER_TEMP,
+            .sample_rate_hz = 10000,
+            .oversample_bits = 4,  // 256 conversions per reading
+            .vsys_period_ms = 0,
+            .service_period_ms = 50,
+            .priority = config->priority,
+            .cores = config->cores,
+        };
+        if (!adc_sampler_start(&sampler)) {
+            return SENSOR_ERR_INIT;
+        }
+    }
+    return adc_sampler_inputs() & (1u << ADC_SAMPLER_TEMP) ? SENSOR_OK : SENSOR_ERR_INIT;
+}
+
+static sensor_status_t die_temp_start(void *ctx) {
+    return SENSOR_OK;  // the sampler converts all the time
+}
+
+static sensor_status_t die_temp_poll(void *ctx) {
+    adc_sampler_sample_t sample;
+    return adc_sampler_latest(ADC_SAMPLER_TEMP, &sample) ? SENSOR_OK : SENSOR_PENDING;
+}
+
+static sensor_status_t die_temp_read(void *ctx, int32_t *values, uint64_t *time_us) {
+    adc_sampler_sample_t sample;
+    if (!adc_sampler_latest(ADC_SAMPLER_TEMP, &sample)) {
+        return SENSOR_ERR_NO_DATA;
+    }
+    values[SENSOR_DIE_TEMP_TEMP] = sensor_fixed_die_temp_centi_c(sample.uv_q7);  // Provided in the Pico datasheet
+    values[SENSOR_DIE_TEMP_MV] = sensor_fixed_uv_q7_to_mv(sample.uv_q7);
+    *time_us = sample.time_us;
+    return SENSOR_OK;
+}
+
+const sensor_driver_t sensor_hal_die_temp = {
+    .name = "die_temp",
+    .values = 2,
+    .value =
+        {
+            [SENSOR_DIE_TEMP_TEMP] = {.name = "temp", .unit = SENSOR_UNIT_CENTI_C, .min = -5500, .max = 15000},
+            [SENSOR_DIE_TEMP_MV] = {.name = "voltage", .unit = SENSOR_UNIT_MV, .min = 0, .max = SENSOR_FIXED_ADC_VREF_MV},
+        },
+    .min_period_ms = 10,
+    .period_ms = 100,
+    .timeout_ms = 100,
+    .init = die_temp_init,
+    .start = die_temp_start,
+    .poll = die_temp_poll,
+    .read = die_temp_read,
+    .ctx = &sensor_hal_die_temp_config,
+};
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <FreeRTOS.h>
+
+#include "sensor_hal.h"
+
+// Values of a die temperature measurement
+#define SENSOR_DIE_TEMP_TEMP 0  // centi-degrees C
+#define SENSOR_DIE_TEMP_MV 1    // sensor voltage in mV
+
+/// @brief Where init places the service task when it starts the ADC sampling service itself
+typedef struct {
+    UBaseType_t priority;
+    UBaseType_t cores;  // < core affinity mask, 0 for any (SMP core affinity only)
+} sensor_hal_die_temp_config_t;
+
+/// @brief Set before sensor_service_start, defaults to tskIDLE_PRIORITY + 1 on any core
+extern sensor_hal_die_temp_config_t sensor_hal_die_temp_config;
+
+/// @brief RP2040 on-die temperature sensor, read through the ADC sampling service (adc_sampler.h)
+/// If nothing started the service, init starts it converting the sensor alone, placed by sensor_hal_die_temp_config
+extern const sensor_driver_t sensor_hal_die_temp;
@@ -0,0 +1,58 @@
+/**
+ * The sensors built into the firmware, in the order they are numbered.
+ *
+ * Pick them with the SENSOR_HAL_* options (src/CMakeLists.txt). A new driver
+ * gets an option and a line here.
+ */
+
+#include "sensor_hal.h"
+#include "sensor_hal_am2320.h"
+#include "sensor_hal_am2320_mux.h"
+#include "sensor_hal_die_temp.h"
+
+#ifndef SENSOR_HAL_DIE_TEMP
+#define SENSOR_HAL_DIE_TEMP 1
+#endif
+
+#ifndef SENSOR_HAL_AM2320
+#define SENSOR_HAL_AM2320 0
+#endif
+
+#if SENSOR_HAL_AM2320 && SENSOR_HAL_AM2320_MUX
+#error "SENSOR_HAL_AM2320 and SENSOR_HAL_AM2320_MUX share the bus and the sensor address, build one of them"
+#endif
+
+const sensor_driver_t *const sensor_registry[] = {
+#if SENSOR_HAL_DIE_TEMP
+    &sensor_hal_die_temp,
+#endif
+#if SENSOR_HAL_AM2320
+    &sensor_hal_am2320,
+#endif
+#if SENSOR_HAL_AM2320_MUX & 0x01
+    &sensor_hal_am2320_mux[0],
+#endif
+#if SENSOR_HAL_AM2320_MUX & 0x02
+    &sensor_hal_am2320_mux[1],
+#endif
+#if SENSOR_HAL_AM2320_MUX & 0x04
+    &sensor_hal_am2320_mux[2],
+#endif
+#if SENSOR_HAL_AM2320_MUX & 0x08
+    &sensor_hal_am2320_mux[3],
+#endif
+#if SENSOR_HAL_AM2320_MUX & 0x10
+    &sensor_hal_am2320_mux[4],
+#endif
+#if SENSOR_HAL_AM2320_MUX & 0x20
+    &sensor_hal_am2320_mux[5],
+#endif
+#if SENSOR_HAL_AM2320_MUX & 0x40
+    &sensor_hal_am2320_mux[6],
+#endif
+#if SENSOR_HAL_AM2320_MUX & 0x80
+    &sensor_hal_am2320_mux[7],
+#endif
+};
+
+const uint8_t sensor_registry_count = sizeof(sensor_registry) / sizeof(sensor_registry[0]);
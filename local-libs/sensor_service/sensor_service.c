@@ -0,0 +1,200 @@
+#include "sensor_service.h"
+
+#include <hardware/sync.h>
+#include <pico/stdlib.h>
+#include <string.h>
+#include <task.h>
+
+#include "seqlock.h"
+
+typedef struct {
+    seqlock_t lock;
+    sensor_snapshot_t snapshot;  // < guarded by lock
+    volatile bool requested;     // < a consumer wants a measurement as soon as allowed
+    bool failed;                 // < init failed, the sensor is left alone
+    bool busy;                   // < a measurement was started and is not collected yet
+    uint64_t started_us;         // < when the last measurement started, 0 if never
+} sensor_state_t;
+
+static sensor_state_t sensors[SENSOR_SERVICE_MAX_SENSORS];
+static uint8_t sensor_count = 0;
+static TaskHandle_t service_task = NULL;
+
+static uint64_t ms_to_us(uint32_t ms) {
+    return (uint64_t)ms * 1000;
+}
+
+// Ticks to sleep for wait_us, rounded up so the task never wakes before a deadline
+static TickType_t us_to_ticks(uint64_t wait_us) {
+    return (TickType_t)((wait_us * configTICK_RATE_HZ + 999999) / 1000000);
+}
+
+static void publish(uint8_t i, sensor_status_t status, const int32_t *values, uint64_t time_us) {
+    sensor_state_t *s = &sensors[i];
+    sensor_snapshot_t next = s->snapshot;  // only this task writes it, no need to read it under the lock
+    if (status == SENSOR_OK) {
+        memcpy(next.value, values, sensor_registry[i]->values * sizeof(int32_t));
+        next.time_us = time_us != 0 ? time_us : time_us_64();
+        next.samples++;
+    } else {
+        next.errors++;
+        next.last_error = status;
+    }
+
+    uint32_t irq = save_and_disable_interrupts();  // a reader on this core must not see it half written
+    seqlock_write_begin(&s->lock);
+    s->snapshot = next;
+    seqlock_write_end(&s->lock);
+    restore_interrupts(irq);
+}
+
+static void start(uint8_t i, uint64_t now) {
+    const sensor_driver_t *driver = sensor_registry[i];
+    sensor_state_t *s = &sensors[i];
+    s->requested = false;
+    s->started_us = now;  // failed starts count too, a missing sensor is not retried any faster
+
+    sensor_status_t status = driver->start(driver->ctx);
+    if (status != SENSOR_OK) {
+        publish(i, status, NULL, 0);
+        return;
+    }
+    s->busy = true;
+}
+
+static void collect(uint8_t i, uint64_t now) {
+    const sensor_driver_t *driver = sensor_registry[i];
+    sensor_state_t *s = &sensors[i];
+    sensor_status_t status = driver->poll(driver->ctx);
+    if (status == SENSOR_PENDING) {
+        if (now - s->started_us < ms_to_us(driver->timeout_ms)) {
+            return;
+        }
+        status = SENSOR_ERR_TIMEOUT;
+    }
+    s->busy = false;
+
+    int32_t values[SENSOR_HAL_MAX_VALUES];
+    uint64_t time_us = 0;
+    if (status == SENSOR_OK) {
+        status = driver->read(driver->ctx, values, &time_us);
+    }
+    if (status == SENSOR_OK) {
+        status = sensor_hal_check(driver, values);
+    }
+    publish(i, status, values, time_us);
+}
+
+// When sensor i next needs looking at
+static uint64_t next_event(uint8_t i, uint64_t now) {
+    const sensor_driver_t *driver = sensor_registry[i];
+    sensor_state_t *s = &sensors[i];
+    if (s->busy) {
+        uint64_t timeout = s->started_us + ms_to_us(driver->timeout_ms);
+        uint64_t poll = now + ms_to_us(SENSOR_SERVICE_POLL_MS);
+        return poll < timeout ? poll : timeout;
+    }
+    if (s->started_us == 0) {
+        return now;
+    }
+
+    // A request only shortens the wait down to what the part allows
+    uint32_t period_ms = driver->period_ms > driver->min_period_ms ? driver->period_ms : driver->min_period_ms;
+    return s->started_us + ms_to_us(s->requested ? driver->min_period_ms : period_ms);
+}
+
+static void wake_service(void *user) {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(service_task, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+// One pass over the sensors, returns when the next one needs looking at
+static uint64_t service_pass(void) {
+    // Start everything that is due before collecting, so the measurements run side by side
+    uint64_t now = time_us_64();
+    for (uint8_t i = 0; i < sensor_count; i++) {
+        if (!sensors[i].failed && !sensors[i].busy && next_event(i, now) <= now) {
+            start(i, now);
+        }
+    }
+
+    now = time_us_64();
+    uint64_t wake = UINT64_MAX;
+    for (uint8_t i = 0; i < sensor_count; i++) {
+        if (sensors[i].failed) {
+            continue;
+        }
+        if (sensors[i].busy) {
+            collect(i, now);
+        }
+        uint64_t next = next_event(i, now);
+        wake = next < wake ? next : wake;
+    }
+    return wake;
+}
+
+static void sensor_service_task(void *pvParameters) {
+    while (true) {
+        uint64_t wake = service_pass();
+
+        // Sleep until the next deadline, a completion or a request
+        uint64_t now = time_us_64();
+        ulTaskNotifyTake(pdTRUE, wake > now ? us_to_ticks(wake - now) : 0);
+    }
+}
+
+bool sensor_service_start(UBaseType_t priority) {
+    if (service_task != NULL) {
+        return false;
+    }
+
+    sensor_count = sensor_registry_count < SENSOR_SERVICE_MAX_SENSORS ? sensor_registry_count
+                                                                      : SENSOR_SERVICE_MAX_SENSORS;
+    for (uint8_t i = 0; i < sensor_count; i++) {
+        const sensor_driver_t *driver = sensor_registry[i];
+        sensor_state_t *s = &sensors[i];
+        seqlock_init(&s->lock);
+        memset(&s->snapshot, 0, sizeof(s->snapshot));
+        s->requested = false;
+        s->busy = false;
+        s->started_us = 0;
+
+        sensor_status_t status = driver->init(driver->ctx);
+        s->failed = status != SENSOR_OK;
+        if (s->failed) {
+            publish(i, status, NULL, 0);
+        }
+    }
+
+    if (xTaskCreate(sensor_service_task, "SENSOR_SERVICE", 256, NULL, priority, &service_task) != pdPASS) {
+        return false;
+    }
+    sensor_hal_set_ready_hook(wake_service, NULL);
+    return true;
+}
+
+bool sensor_service_read(uint8_t sensor, sensor_snapshot_t *out) {
+    if (sensor >= sensor_count) {
+        memset(out, 0, sizeof(*out));
+        return false;
+    }
+
+    const sensor_state_t *s = &sensors[sensor];
+    uint32_t seq;
+    do {
+        seq = seqlock_read_begin(&s->lock);
+        *out = s->snapshot;
+    } while (seqlock_read_retry(&s->lock, seq));
+    return out->time_us != 0;
+}
+
+void sensor_service_request(uint8_t sensor) {
+    if (sensor >= sensor_count) {
+        return;
+    }
+    sensors[sensor].requested = true;
+    if (service_task != NULL) {
+        xTaskNotifyGive(service_task);
+    }
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+/**
+ * Sensor service: one task owns the sensors and everybody else reads snapshots.
+ *
+ * The service runs every sensor of the registry (sensor_hal.h) on its own
+ * schedule, never faster than the part allows (min_period_ms, e.g. 2 s for the
+ * AM2320), whoever asks for data. The sensors due at the same time are started
+ * together and collected as they complete, so their bus work interleaves. Each
+ * completed measurement is checked against the driver's ranges and published
+ * with its timestamp.
+ *
+ * The published snapshot is guarded by a seqlock (seqlock.h): reading it is a
+ * copy of a few words, never blocks, takes no lock and works from either core
+ * or an interrupt. Display, logging and network code all read the same sample
+ * instead of each causing their own bus transfers.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <FreeRTOS.h>
+
+#include "sensor_hal.h"
+
+#define SENSOR_SERVICE_MAX_SENSORS 8  // Registry entries the service runs
+#define SENSOR_SERVICE_POLL_MS 5      // How often running measurements are polled if their driver never calls sensor_hal_ready
+
+typedef struct {
+    int32_t value[SENSOR_HAL_MAX_VALUES];  // < latest valid measurement, units as in the driver
+    uint64_t time_us;                      // < when it was measured, 0 until the first one
+    uint32_t samples;                      // < valid measurements so far
+    uint32_t errors;                       // < failed or rejected measurements so far
+    sensor_status_t last_error;            // < status of the last failure, SENSOR_OK if none yet
+} sensor_snapshot_t;
+
+/// @brief Set up every registry sensor and create the service task, measurements start right away
+/// @return false if it is already running or the task could not be created (a sensor failing init is only skipped)
+bool sensor_service_start(UBaseType_t priority);
+
+/// @brief Copy the latest snapshot of registry entry sensor, never blocks, safe from either core and from interrupts
+/// @return true if it holds a measurement (the error counters are copied either way)
+bool sensor_service_read(uint8_t sensor, sensor_snapshot_t *out);
+
+/// @brief Ask for a fresh measurement as soon as the sensor's min_period_ms allows
+/// Requests made before that are merged into one measurement. Safe from tasks only
+void sensor_service_request(uint8_t sensor);
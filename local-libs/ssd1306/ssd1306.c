@@ -30,42 +30,77 @@ SOFTWARE.
 #include <string.h>
 #include <stdio.h>
 
+#include <FreeRTOS.h>
+#include <semphr.h>
+#include <task.h>
+
 #include "ssd1306.h"
 #include "font.h"
 
-inline static void swap(int32_t *a, int32_t *b) {
-    int32_t *t=a;
-    *a=*b;
-    *b=*t;
-}
-
-inline static void fancy_write(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, char *name) {
-    switch(i2c_write_blocking(i2c, addr, src, len, false)) {
+#ifndef SSD1306_FONT_SCALE_2
+#define SSD1306_FONT_SCALE_2 1
+#endif
+#ifndef SSD1306_FONT_SCALE_3
+#define SSD1306_FONT_SCALE_3 0
+#endif
+#ifndef SSD1306_FONT_SCALE_4
+#define SSD1306_FONT_SCALE_4 0
+#endif
+#include "font_8x5_scaled.h"
+
+inline static size_t fancy_write(ssd1306_t *p, const uint8_t *src, size_t len, char *name) {
+    int ret=p->bus?i2c_bus_write(p->bus, p->address, src, len, false):i2c_write_blocking(p->i2c_i, p->address, src, len, false);
+    switch(ret) {
     case PICO_ERROR_GENERIC:
         printf("[%s] addr not acknowledged!\n", name);
-        break;
+        return 1;
     case PICO_ERROR_TIMEOUT:
         printf("[%s] timeout!\n", name);
-        break;
+        return 0;
     default:
         //printf("[%s] wrote successfully %lu bytes!\n", name, len);
-        break;
+        return len+1; // payload + address byte
     }
 }
 
-inline static void ssd1306_write(ssd1306_t *p, uint8_t val) {
-    uint8_t d[2]= {0x00, val};
-    fancy_write(p->i2c_i, p->address, d, 2, "ssd1306_write");
+// largest number of commands packed behind one 0x00 control byte
+#define SSD1306_CMD_BATCH 32
+
+size_t ssd1306_write_commands(ssd1306_t *p, const uint8_t *cmds, size_t len) {
+    uint8_t d[SSD1306_CMD_BATCH+1];
+    size_t sent=0;
+
+    d[0]=0x00;
+    while(len) {
+        size_t n=len>SSD1306_CMD_BATCH?SSD1306_CMD_BATCH:len;
+        memcpy(d+1, cmds, n);
+        sent+=fancy_write(p, d, n+1, "ssd1306_write_commands");
+        cmds+=n;
+        len-=n;
+    }
+    return sent;
 }
 
-bool ssd1306_init(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address, i2c_inst_t *i2c_instance) {
+inline static void ssd1306_mark_dirty(ssd1306_t *p, uint32_t page, uint32_t x0, uint32_t x1) {
+    if(x0<p->dirty_x0[page])
+        p->dirty_x0[page]=x0;
+    if(x1>p->dirty_x1[page])
+        p->dirty_x1[page]=x1;
+}
+
+inline static void ssd1306_mark_clean(ssd1306_t *p) {
+    memset(p->dirty_x0, 0xFF, sizeof(p->dirty_x0));
+    memset(p->dirty_x1, 0x00, sizeof(p->dirty_x1));
+}
+
+static bool ssd1306_setup(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address) {
     p->width=width;
     p->height=height;
     p->pages=height/8;
     p->address=address;
 
-    p->i2c_i=i2c_instance;
-
+    if(p->pages>SSD1306_MAX_PAGES)
+        return false;
 
     p->bufsize=(p->pages)*(p->width);
     if((p->buffer=malloc(p->bufsize+1))==NULL) {
@@ -75,6 +110,17 @@ bool ssd1306_init(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address
 
     ++(p->buffer);
 
+    if((p->shadow=malloc(p->bufsize))==NULL) {
+        free(p->buffer-1);
+        p->bufsize=0;
+        return false;
+    }
+
+    p->shadow_valid=false;
+    p->front=NULL;
+    ssd1306_mark_clean(p);
+    memset(&p->stats, 0, sizeof(p->stats));
+
     // from https://github.com/makerportal/rpi-pico-ssd1306
     uint8_t cmds[]= {
         SET_DISP,
@@ -109,83 +155,398 @@ bool ssd1306_init(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address
         0x00,  // horizontal
     };
 
-    for(size_t i=0; i<sizeof(cmds); ++i)
-        ssd1306_write(p, cmds[i]);
+    ssd1306_write_commands(p, cmds, sizeof(cmds));
 
     return true;
 }
 
+bool ssd1306_init(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address, i2c_inst_t *i2c_instance) {
+    p->i2c_i=i2c_instance;
+    p->bus=NULL;
+    return ssd1306_setup(p, width, height, address);
+}
+
+bool ssd1306_init_with_bus(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address, i2c_bus_t *bus) {
+    p->i2c_i=NULL;
+    p->bus=bus;
+    return ssd1306_setup(p, width, height, address);
+}
+
 inline void ssd1306_deinit(ssd1306_t *p) {
+    if(p->front!=NULL) {
+        ssd1306_sync(p);
+        vTaskDelete(p->flush_task);
+        vSemaphoreDelete(p->front_free);
+        free(p->front-1);
+    }
     free(p->buffer-1);
+    free(p->shadow);
 }
 
+// commands must not overtake a frame still being flushed
 inline void ssd1306_poweroff(ssd1306_t *p) {
-    ssd1306_write(p, SET_DISP|0x00);
+    uint8_t cmd=SET_DISP|0x00;
+    ssd1306_sync(p);
+    ssd1306_write_commands(p, &cmd, 1);
 }
 
 inline void ssd1306_poweron(ssd1306_t *p) {
-    ssd1306_write(p, SET_DISP|0x01);
+    uint8_t cmd=SET_DISP|0x01;
+    ssd1306_sync(p);
+    ssd1306_write_commands(p, &cmd, 1);
 }
 
 inline void ssd1306_contrast(ssd1306_t *p, uint8_t val) {
-    ssd1306_write(p, SET_CONTRAST);
-    ssd1306_write(p, val);
+    uint8_t cmds[]= {SET_CONTRAST, val};
+    ssd1306_sync(p);
+    ssd1306_write_commands(p, cmds, sizeof(cmds));
 }
 
 inline void ssd1306_invert(ssd1306_t *p, uint8_t inv) {
-    ssd1306_write(p, SET_NORM_INV | (inv & 1));
+    uint8_t cmd=SET_NORM_INV | (inv & 1);
+    ssd1306_sync(p);
+    ssd1306_write_commands(p, &cmd, 1);
 }
 
 inline void ssd1306_clear(ssd1306_t *p) {
     memset(p->buffer, 0, p->bufsize);
+    for(uint8_t page=0; page<p->pages; ++page)
+        ssd1306_mark_dirty(p, page, 0, p->width-1);
+}
+
+void ssd1306_invalidate(ssd1306_t *p) {
+    ssd1306_sync(p); // the flush task sets shadow_valid itself
+    p->shadow_valid=false;
 }
 
 void ssd1306_draw_pixel(ssd1306_t *p, uint32_t x, uint32_t y) {
     if(x>=p->width || y>=p->height) return;
 
     p->buffer[x+p->width*(y>>3)]|=0x1<<(y&0x07); // y>>3==y/8 && y&0x7==y%8
+    ssd1306_mark_dirty(p, y>>3, x, x);
 }
 
-void ssd1306_draw_line(ssd1306_t *p, int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
-    if(x1>x2) {
-        swap(&x1, &x2);
-        swap(&y1, &y2);
+// fills the rectangle clipped to the display, one byte per column and page
+static void ssd1306_fill_rect(ssd1306_t *p, int32_t x, int32_t y, int32_t width, int32_t height, ssd1306_draw_mode_t mode) {
+    if(x<0) {
+        width+=x;
+        x=0;
+    }
+    if(y<0) {
+        height+=y;
+        y=0;
+    }
+    if(width<=0 || height<=0 || x>=p->width || y>=p->height)
+        return;
+    if(width>p->width-x)
+        width=p->width-x;
+    if(height>p->height-y)
+        height=p->height-y;
+
+    uint32_t y_last=y+height-1;
+    uint32_t page_first=y>>3, page_last=y_last>>3;
+    uint8_t *row=p->buffer+page_first*p->width+x;
+
+    for(uint32_t page=page_first; page<=page_last; ++page, row+=p->width) {
+        uint8_t mask=0xFF;
+        if(page==page_first)
+            mask&=0xFF<<(y&7);
+        if(page==page_last)
+            mask&=0xFF>>(7-(y_last&7));
+
+        if(mask==0xFF && mode!=SSD1306_DRAW_XOR) {
+            memset(row, mode==SSD1306_DRAW_SET?0xFF:0x00, width);
+        } else if(mode==SSD1306_DRAW_SET) {
+            for(int32_t i=0; i<width; ++i)
+                row[i]|=mask;
+        } else if(mode==SSD1306_DRAW_CLEAR) {
+            for(int32_t i=0; i<width; ++i)
+                row[i]&=~mask;
+        } else {
+            for(int32_t i=0; i<width; ++i)
+                row[i]^=mask;
+        }
+        ssd1306_mark_dirty(p, page, x, x+width-1);
+    }
+}
+
+void ssd1306_draw_hline(ssd1306_t *p, int32_t x, int32_t y, uint32_t width) {
+    ssd1306_fill_rect(p, x, y, width>INT32_MAX?INT32_MAX:width, 1, SSD1306_DRAW_SET);
+}
+
+void ssd1306_draw_vline(ssd1306_t *p, int32_t x, int32_t y, uint32_t height) {
+    ssd1306_fill_rect(p, x, y, 1, height>INT32_MAX?INT32_MAX:height, SSD1306_DRAW_SET);
+}
+
+void ssd1306_draw_square(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    if(x>=p->width || y>=p->height)
+        return;
+
+    ssd1306_fill_rect(p, x, y, width>p->width?p->width:width, height>p->height?p->height:height, SSD1306_DRAW_SET);
+}
+
+// Cohen-Sutherland region codes
+#define CLIP_LEFT 1
+#define CLIP_RIGHT 2
+#define CLIP_TOP 4
+#define CLIP_BOTTOM 8
+
+static inline uint8_t ssd1306_outcode(ssd1306_t *p, int32_t x, int32_t y) {
+    uint8_t code=0;
+    if(x<0)
+        code|=CLIP_LEFT;
+    else if(x>=p->width)
+        code|=CLIP_RIGHT;
+    if(y<0)
+        code|=CLIP_TOP;
+    else if(y>=p->height)
+        code|=CLIP_BOTTOM;
+    return code;
+}
+
+// a/b rounded to nearest, halves away from zero (a*2 could overflow, the remainder cannot)
+static inline int64_t ssd1306_div_round(int64_t a, int64_t b) {
+    int64_t q=a/b, r=a%b;
+    if(2*(r<0?-r:r)>=(b<0?-b:b))
+        q+=(a<0)==(b<0)?1:-1;
+    return q;
+}
+
+// clips the segment to the display, returns false if nothing is left.
+// each end is moved along the original line from where it started, rounded to the
+// nearest pixel, so the clipped line stays within a pixel of the unclipped one
+static bool ssd1306_clip_line(ssd1306_t *p, int32_t *x1, int32_t *y1, int32_t *x2, int32_t *y2) {
+    const int32_t ox1=*x1, oy1=*y1, ox2=*x2, oy2=*y2;
+    const int64_t dx=(int64_t)ox2-ox1, dy=(int64_t)oy2-oy1;
+    uint8_t code1=ssd1306_outcode(p, *x1, *y1);
+    uint8_t code2=ssd1306_outcode(p, *x2, *y2);
+
+    // at most two edges per end, one more when rounding lands a pixel past the other
+    // edge; a line grazing a corner from outside bounces between the two for ever
+    for(uint8_t steps=0; code1|code2; ++steps) {
+        if((code1&code2) || steps==6)
+            return false;
+
+        uint8_t code=code1?code1:code2;
+        // |edge-origin| stays within 2^31, so the products fit in 64 bits
+        int64_t ox=code==code1?ox1:ox2, oy=code==code1?oy1:oy2;
+        int32_t x, y;
+
+        if(code&CLIP_TOP) {
+            y=0;
+            x=ox+ssd1306_div_round(dx*(y-oy), dy);
+        } else if(code&CLIP_BOTTOM) {
+            y=p->height-1;
+            x=ox+ssd1306_div_round(dx*(y-oy), dy);
+        } else if(code&CLIP_LEFT) {
+            x=0;
+            y=oy+ssd1306_div_round(dy*(x-ox), dx);
+        } else {
+            x=p->width-1;
+            y=oy+ssd1306_div_round(dy*(x-ox), dx);
+        }
+
+        if(code==code1) {
+            *x1=x;
+            *y1=y;
+            code1=ssd1306_outcode(p, x, y);
+        } else {
+            *x2=x;
+            *y2=y;
+            code2=ssd1306_outcode(p, x, y);
+        }
     }
 
+    return true;
+}
+
+// caller guarantees x/y are on the display
+static inline void ssd1306_plot(ssd1306_t *p, int32_t x, int32_t y, ssd1306_draw_mode_t mode) {
+    uint8_t *b=&p->buffer[x+p->width*(y>>3)];
+    uint8_t bit=0x1<<(y&0x07);
+
+    if(mode==SSD1306_DRAW_SET)
+        *b|=bit;
+    else if(mode==SSD1306_DRAW_CLEAR)
+        *b&=~bit;
+    else
+        *b^=bit;
+    ssd1306_mark_dirty(p, y>>3, x, x);
+}
+
+void ssd1306_draw_line_with_mode(ssd1306_t *p, int32_t x1, int32_t y1, int32_t x2, int32_t y2, ssd1306_draw_mode_t mode) {
+    // axis aligned lines go through the page fill, clamped first so the length cannot overflow
+    if(y1==y2) {
+        int32_t lo=x1<x2?x1:x2, hi=x1<x2?x2:x1;
+        if(lo<0)
+            lo=0;
+        if(hi>=p->width)
+            hi=p->width-1;
+        if(lo<=hi)
+            ssd1306_fill_rect(p, lo, y1, hi-lo+1, 1, mode);
+        return;
+    }
     if(x1==x2) {
-        if(y1>y2)
-            swap(&y1, &y2);
-        for(int32_t i=y1; i<=y2; ++i)
-            ssd1306_draw_pixel(p, x1, i);
+        int32_t lo=y1<y2?y1:y2, hi=y1<y2?y2:y1;
+        if(lo<0)
+            lo=0;
+        if(hi>=p->height)
+            hi=p->height-1;
+        if(lo<=hi)
+            ssd1306_fill_rect(p, x1, lo, 1, hi-lo+1, mode);
         return;
     }
 
-    float m=(float) (y2-y1) / (float) (x2-x1);
+    if(!ssd1306_clip_line(p, &x1, &y1, &x2, &y2))
+        return;
+
+    // integer Bresenham, covers all octants without gaps
+    int32_t dx=x2>x1?x2-x1:x1-x2;
+    int32_t dy=y2>y1?y1-y2:y2-y1;
+    int32_t sx=x1<x2?1:-1;
+    int32_t sy=y1<y2?1:-1;
+    int32_t err=dx+dy;
+
+    while(true) {
+        ssd1306_plot(p, x1, y1, mode);
+        if(x1==x2 && y1==y2)
+            break;
 
-    for(int32_t i=x1; i<=x2; ++i) {
-        float y=m*(float) (i-x1)+(float) y1;
-        ssd1306_draw_pixel(p, i, (uint32_t) y);
+        int32_t e2=2*err;
+        if(e2>=dy) {
+            err+=dy;
+            x1+=sx;
+        }
+        if(e2<=dx) {
+            err+=dx;
+            y1+=sy;
+        }
     }
 }
 
-void ssd1306_draw_square(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
-    for(uint32_t i=0; i<width; ++i)
-        for(uint32_t j=0; j<height; ++j)
-            ssd1306_draw_pixel(p, x+i, y+j);
-
+void ssd1306_draw_line(ssd1306_t *p, int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
+    ssd1306_draw_line_with_mode(p, x1, y1, x2, y2, SSD1306_DRAW_SET);
 }
 
 void ssd13606_draw_empty_square(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
-    ssd1306_draw_line(p, x, y, x+width, y);
-    ssd1306_draw_line(p, x, y+height, x+width, y+height);
-    ssd1306_draw_line(p, x, y, x, y+height);
-    ssd1306_draw_line(p, x+width, y, x+width, y+height);
+    if(x>=p->width || y>=p->height)
+        return;
+    if(width>p->width)
+        width=p->width;
+    if(height>p->height)
+        height=p->height;
+
+    ssd1306_draw_hline(p, x, y, width+1);
+    ssd1306_draw_hline(p, x, y+height, width+1);
+    ssd1306_draw_vline(p, x, y, height+1);
+    ssd1306_draw_vline(p, x+width, y, height+1);
+}
+
+// ORs the glyph column bytes straight into the page buffer (scale 1 only).
+// a glyph part lands in at most two pages, a page aligned y needs no shifting at all
+static void ssd1306_blit_string(ssd1306_t *p, int32_t x, uint32_t y, const uint8_t *font, const char *s) {
+    if(y>=p->height)
+        return;
+
+    // locals, the byte stores below may alias anything and would reload p-> every column
+    const int32_t width=p->width;
+    const uint32_t pages=p->pages;
+    uint8_t *const buffer=p->buffer;
+    const uint32_t parts_per_line=(font[0]>>3)+((font[0]&7)>0);
+    const uint32_t shift=y&7;
+    const uint32_t page_first=y>>3;
+    const uint32_t parts=page_first+parts_per_line<=pages?parts_per_line:pages-page_first;
+    const bool spill=shift && page_first+parts<pages;  // the last part's low bits go one page further
+    const uint8_t first_char=font[3], last_char=font[4], glyph_width=font[1];
+    const int32_t advance=font[1]+font[2];
+    const int32_t x_start=x;
+
+    for(; *s && x<width; ++s, x+=advance) {
+        uint8_t c=*s;
+        if(c<first_char||c>last_char)
+            continue;
+
+        const uint8_t *glyph=font+5+(c-first_char)*glyph_width*parts_per_line;
+        for(int32_t w=0; w<glyph_width; ++w, glyph+=parts_per_line) {
+            int32_t col=x+w;
+            if(col<0)
+                continue;
+            if(col>=width)
+                break;
+
+            uint8_t *dst=buffer+page_first*width+col;
+            if(!shift) {
+                for(uint32_t lp=0; lp<parts; ++lp, dst+=width)
+                    *dst|=glyph[lp];
+                continue;
+            }
+
+            uint8_t carry=0;
+            for(uint32_t lp=0; lp<parts; ++lp, dst+=width) {
+                uint8_t bits=glyph[lp];
+                *dst|=(uint8_t)(bits<<shift)|carry;
+                carry=bits>>(8-shift);
+            }
+            if(spill)
+                *dst|=carry;
+        }
+    }
+
+    int32_t col_first=x_start<0?0:x_start;
+    int32_t col_last=x-advance+font[1]-1;
+    if(col_last>=p->width)
+        col_last=p->width-1;
+    if(col_first>col_last)
+        return;
+
+    uint32_t page_last=page_first+parts_per_line-(shift?0:1);
+    if(page_last>=p->pages)
+        page_last=p->pages-1;
+    for(uint32_t page=page_first; page<=page_last; ++page)
+        ssd1306_mark_dirty(p, page, col_first, col_last);
+}
+
+// pre-expanded copy of font for scale, NULL if none was built in
+static const uint8_t *ssd1306_scaled_font(const uint8_t *font, uint32_t scale) {
+    if(font!=font_8x5)
+        return NULL;
+
+    switch(scale) {
+#if SSD1306_FONT_SCALE_2
+    case 2:
+        return font_8x5_x2;
+#endif
+#if SSD1306_FONT_SCALE_3
+    case 3:
+        return font_8x5_x3;
+#endif
+#if SSD1306_FONT_SCALE_4
+    case 4:
+        return font_8x5_x4;
+#endif
+    default:
+        return NULL;
+    }
 }
 
 void ssd1306_draw_char_with_font(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const uint8_t *font, char c) {
     if(c<font[3]||c>font[4])
         return;
 
+    const uint8_t *scaled=ssd1306_scaled_font(font, scale);
+    if(scaled!=NULL) {
+        font=scaled;
+        scale=1;
+    }
+
+    if(scale==1) {
+        if(x>=p->width)
+            return;
+        char s[2]= {c, '\0'};
+        ssd1306_blit_string(p, x, y, font, s);
+        return;
+    }
+
     uint32_t parts_per_line=(font[0]>>3)+((font[0]&7)>0);
     for(uint8_t w=0; w<font[1]; ++w) { // width
         uint32_t pp=(c-font[3])*font[1]*parts_per_line+w*parts_per_line+5;
@@ -203,6 +564,18 @@ void ssd1306_draw_char_with_font(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t
 }
 
 void ssd1306_draw_string_with_font(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const uint8_t *font, const char *s) {
+    const uint8_t *scaled=ssd1306_scaled_font(font, scale);
+    if(scaled!=NULL) {
+        font=scaled;
+        scale=1;
+    }
+
+    if(scale==1) {
+        if(x<p->width)
+            ssd1306_blit_string(p, x, y, font, s);
+        return;
+    }
+
     for(int32_t x_n=x; *s; x_n+=(font[1]+font[2])*scale) {
         ssd1306_draw_char_with_font(p, x_n, y, scale, font, *(s++));
     }
@@ -278,17 +651,159 @@ inline void ssd1306_bmp_show_image(ssd1306_t *p, const uint8_t *data, const long
     ssd1306_bmp_show_image_with_offset(p, data, size, 0, 0);
 }
 
-void ssd1306_show(ssd1306_t *p) {
-    uint8_t payload[]= {SET_COL_ADDR, 0, p->width-1, SET_PAGE_ADDR, 0, p->pages-1};
+// bytes on the wire for one SET_COL_ADDR/SET_PAGE_ADDR window (one 6 command transaction) plus the data header
+#define SSD1306_WINDOW_OVERHEAD ((2+6)+2)
+
+// multi-page windows must span the full width, so the data is contiguous in the buffer
+static size_t ssd1306_send_window(ssd1306_t *p, uint8_t *buf, uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1) {
+    uint8_t payload[]= {SET_COL_ADDR, x0, x1, SET_PAGE_ADDR, page0, page1};
     if(p->width==64) {
         payload[1]+=32;
         payload[2]+=32;
     }
 
-    for(size_t i=0; i<sizeof(payload); ++i)
-        ssd1306_write(p, payload[i]);
+    size_t sent=ssd1306_write_commands(p, payload, sizeof(payload));
+
+    // control and address byte included; without the window the data would land
+    // wherever the RAM pointers were left, so it is not sent at all
+    if(sent!=sizeof(payload)+2) {
+        p->shadow_valid=false;
+        return sent;
+    }
+
+    // the byte in front of the window is borrowed for the 0x40 data control byte
+    uint8_t *start=buf+page0*p->width+x0;
+    uint8_t saved=*(start-1);
+    *(start-1)=0x40;
+
+    size_t len=(page1-page0)*p->width+(x1-x0+1);
+    size_t data_sent=fancy_write(p, start-1, len+1, "ssd1306_show");
+
+    *(start-1)=saved;
+
+    // the display RAM content is unknown after a failed transfer
+    if(data_sent!=len+2)
+        p->shadow_valid=false;
+    sent+=data_sent;
+    return sent;
+}
+
+// sends the damaged spans of buf (x0s/x1s per page) and brings the shadow up to date
+static void ssd1306_transmit(ssd1306_t *p, uint8_t *buf, uint8_t *x0s, uint8_t *x1s) {
+    size_t sent=0;
+    ++p->stats.shows;
+
+    // shrink each damaged span to the bytes that really differ from the display RAM
+    size_t cost=0;
+    if(p->shadow_valid) {
+        for(uint8_t page=0; page<p->pages; ++page) {
+            const uint8_t *row=buf+page*p->width;
+            const uint8_t *shd=p->shadow+page*p->width;
+            uint32_t x0=x0s[page], x1=x1s[page];
+
+            while(x0<=x1 && row[x0]==shd[x0])
+                ++x0;
+            while(x1>x0 && row[x1]==shd[x1])
+                --x1;
+
+            x0s[page]=x0;
+            x1s[page]=x1;
+            if(x0<=x1)
+                cost+=SSD1306_WINDOW_OVERHEAD+(x1-x0+1);
+        }
+    }
+
+    if(!p->shadow_valid || cost>=SSD1306_WINDOW_OVERHEAD+p->bufsize) {
+        p->shadow_valid=true;
+        sent=ssd1306_send_window(p, buf, 0, p->width-1, 0, p->pages-1);
+        ++p->stats.full_pushes;
+    } else {
+        for(uint8_t page=0; page<p->pages; ++page) {
+            if(x0s[page]<=x1s[page])
+                sent+=ssd1306_send_window(p, buf, x0s[page], x1s[page], page, page);
+        }
+    }
+
+    memcpy(p->shadow, buf, p->bufsize);
+
+    p->stats.last_bytes=sent;
+    p->stats.total_bytes+=sent;
+}
+
+static void ssd1306_flush_task(void *pvParameters) {
+    ssd1306_t *p=pvParameters;
+
+    while(true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        ssd1306_transmit(p, p->front, p->front_x0, p->front_x1);
+        xSemaphoreGive(p->front_free);
+    }
+}
+
+bool ssd1306_double_buffer_start(ssd1306_t *p, UBaseType_t priority, UBaseType_t cores) {
+    if(p->front!=NULL)
+        return true;
+
+    uint8_t *front=malloc(p->bufsize+1);
+    if(front==NULL)
+        return false;
+
+    if((p->front_free=xSemaphoreCreateBinary())==NULL) {
+        free(front);
+        return false;
+    }
+    xSemaphoreGive(p->front_free);
+
+    p->front=front+1;
+#if defined(configNUM_CORES) && configNUM_CORES > 1 && configUSE_CORE_AFFINITY
+    BaseType_t created=xTaskCreateAffinitySet(ssd1306_flush_task, "SSD1306_FLUSH", 512, p, priority, cores, &p->flush_task);
+#else
+    BaseType_t created=xTaskCreate(ssd1306_flush_task, "SSD1306_FLUSH", 512, p, priority, &p->flush_task);
+#endif
+    if(created!=pdPASS) {
+        vSemaphoreDelete(p->front_free);
+        free(front);
+        p->front=NULL;
+        return false;
+    }
+
+    return true;
+}
+
+void ssd1306_sync(ssd1306_t *p) {
+    if(p->front==NULL)
+        return;
+
+    xSemaphoreTake(p->front_free, portMAX_DELAY);
+    xSemaphoreGive(p->front_free);
+}
+
+// stats and shadow belong to the flush task until the frame is out, and it stays
+// idle after a sync until the next show
+void ssd1306_get_stats(ssd1306_t *p, ssd1306_stats_t *out) {
+    ssd1306_sync(p);
+    *out=p->stats;
+}
+
+void ssd1306_show(ssd1306_t *p) {
+    if(p->front==NULL) {
+        ssd1306_transmit(p, p->buffer, p->dirty_x0, p->dirty_x1);
+        ssd1306_mark_clean(p);
+        return;
+    }
+
+    // wait for the previous frame to leave the front buffer, then swap
+    xSemaphoreTake(p->front_free, portMAX_DELAY);
 
-    *(p->buffer-1)=0x40;
+    uint8_t *finished=p->buffer;
+    p->buffer=p->front;
+    p->front=finished;
+    memcpy(p->front_x0, p->dirty_x0, sizeof(p->front_x0));
+    memcpy(p->front_x1, p->dirty_x1, sizeof(p->front_x1));
 
-    fancy_write(p->i2c_i, p->address, p->buffer-1, p->bufsize+1, "ssd1306_show");
-}
\ No newline at end of file
+    // the new back buffer starts out as a copy of the frame being sent
+    memcpy(p->buffer, p->front, p->bufsize);
+    ssd1306_mark_clean(p);
+
+    xTaskNotifyGive(p->flush_task);
+}
@@ -30,9 +30,18 @@ SOFTWARE.
 
 #ifndef _inc_ssd1306
 #define _inc_ssd1306
-#include <pico/stdlib.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
 #include <hardware/i2c.h>
 
+#include <FreeRTOS.h>
+#include <semphr.h>
+#include <task.h>
+
+#include "i2c_bus.h"
+
 /**
 *	@brief defines commands used in ssd1306
 */
@@ -56,6 +65,31 @@ typedef enum {
     SET_CHARGE_PUMP = 0x8D
 } ssd1306_command_t;
 
+/**
+*	@brief how drawn pixels are combined with the buffer
+*/
+typedef enum {
+    SSD1306_DRAW_SET,	/**< turn pixels on */
+    SSD1306_DRAW_CLEAR,	/**< turn pixels off */
+    SSD1306_DRAW_XOR	/**< toggle pixels */
+} ssd1306_draw_mode_t;
+
+/**
+*	@brief maximum number of pages supported (64 pixel high panels)
+*/
+#define SSD1306_MAX_PAGES 8
+
+/**
+*	@brief bus traffic counters, updated by ssd1306_show (by the flush task in double buffer mode,
+*	read them with ssd1306_get_stats)
+*/
+typedef struct {
+    uint32_t shows;			/**< number of calls to ssd1306_show */
+    uint32_t full_pushes;	/**< shows that transmitted the whole buffer */
+    uint32_t last_bytes;	/**< bytes put on the bus by the last show (address bytes included) */
+    uint64_t total_bytes;	/**< bytes put on the bus by all shows */
+} ssd1306_stats_t;
+
 /**
 *	@brief holds the configuration
 */
@@ -65,9 +99,20 @@ typedef struct {
     uint8_t pages;		/**< stores pages of display (calculated on initialization*/
     uint8_t address; 	/**< i2c address of display*/
     i2c_inst_t *i2c_i; 	/**< i2c connection instance */
+    i2c_bus_t *bus;		/**< asynchronous bus, NULL to use blocking transfers on i2c_i */
     bool external_vcc; 	/**< whether display uses external vcc */ 
     uint8_t *buffer;	/**< display buffer */
     size_t bufsize;		/**< buffer size */
+    uint8_t *shadow;	/**< copy of what the display RAM currently holds (owned by the flush task while it runs) */
+    bool shadow_valid;	/**< false until the first show, forces a full push */
+    uint8_t dirty_x0[SSD1306_MAX_PAGES];	/**< first damaged column per page */
+    uint8_t dirty_x1[SSD1306_MAX_PAGES];	/**< last damaged column per page (clean if dirty_x0>dirty_x1) */
+    ssd1306_stats_t stats;	/**< bus traffic counters, see ssd1306_get_stats */
+    uint8_t *front;		/**< buffer being flushed in double buffer mode, NULL when single buffered */
+    uint8_t front_x0[SSD1306_MAX_PAGES];	/**< damaged spans of the front buffer */
+    uint8_t front_x1[SSD1306_MAX_PAGES];
+    TaskHandle_t flush_task;	/**< task sending the front buffer */
+    SemaphoreHandle_t front_free;	/**< given while the front buffer is not being sent */
 } ssd1306_t;
 
 /**
@@ -85,6 +130,21 @@ typedef struct {
 */
 bool ssd1306_init(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address, i2c_inst_t *i2c_instance);
 
+/**
+*	@brief initialize display on an asynchronous bus, the calling task sleeps during transfers
+*
+*	@param[in] p : pointer to instance of ssd1306_t
+*	@param[in] width : width of display
+*	@param[in] height : heigth of display
+*	@param[in] address : i2c address of display
+*	@param[in] bus : bus the display is attached to
+*	
+* 	@return bool.
+*	@retval true for Success
+*	@retval false if initialization failed
+*/
+bool ssd1306_init_with_bus(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address, i2c_bus_t *bus);
+
 /**
  * @brief deinitialize the display and free up the memory. remember to release your GPIO too
  * 
@@ -92,6 +152,17 @@ bool ssd1306_init(ssd1306_t *p, uint16_t width, uint16_t height, uint8_t address
 */
 void ssd1306_deinit(ssd1306_t *p);
 
+/**
+*	@brief send several commands in one i2c transaction behind a single 0x00 control byte
+*
+*	@param[in] p : instance of display
+*	@param[in] cmds : command bytes, including their arguments
+*	@param[in] len : number of bytes in cmds
+*
+*	@return bytes put on the bus, address bytes included
+*/
+size_t ssd1306_write_commands(ssd1306_t *p, const uint8_t *cmds, size_t len);
+
 /**
 *	@brief turn off display
 *
@@ -129,11 +200,56 @@ void ssd1306_invert(ssd1306_t *p, uint8_t inv);
 /**
 	@brief display buffer, should be called on change
 
+	only the column ranges damaged since the last show are transmitted,
+	unless sending the whole buffer is cheaper
+
 	@param[in] p : instance of display
 
 */
 void ssd1306_show(ssd1306_t *p);
 
+/**
+	@brief switch to double buffering: ssd1306_show hands the finished buffer to a
+	flush task and returns straight away with a back buffer holding a copy of it
+
+	@param[in] p : instance of display
+	@param[in] priority : priority of the flush task
+	@param[in] cores : core affinity mask of the flush task, set as it is created so it never
+	runs elsewhere (ignored without SMP core affinity)
+
+	@return bool.
+	@retval true for Success
+	@retval false if the buffer or task could not be allocated
+*/
+bool ssd1306_double_buffer_start(ssd1306_t *p, UBaseType_t priority, UBaseType_t cores);
+
+/**
+	@brief fence: wait until every shown frame is on the display (no-op when single buffered)
+
+	@param[in] p : instance of display
+
+*/
+void ssd1306_sync(ssd1306_t *p);
+
+/**
+	@brief copy the bus traffic counters. waits for the frame being flushed first (ssd1306_sync),
+	so the copy includes it and is not taken while the flush task updates the counters
+
+	@param[in] p : instance of display
+	@param[out] out : the counters
+
+*/
+void ssd1306_get_stats(ssd1306_t *p, ssd1306_stats_t *out);
+
+/**
+	@brief mark the whole buffer as damaged so the next show pushes a full frame
+	(waits for the frame being flushed, like ssd1306_sync)
+
+	@param[in] p : instance of display
+
+*/
+void ssd1306_invalidate(ssd1306_t *p);
+
 /**
 	@brief clear display buffer
 
@@ -152,7 +268,7 @@ void ssd1306_clear(ssd1306_t *p);
 void ssd1306_draw_pixel(ssd1306_t *p, uint32_t x, uint32_t y);
 
 /**
-	@brief draw pixel on buffer
+	@brief draw line on buffer, clipped to the display
 
 	@param[in] p : instance of display
 	@param[in] x1 : x position of starting point
@@ -162,6 +278,38 @@ void ssd1306_draw_pixel(ssd1306_t *p, uint32_t x, uint32_t y);
 */
 void ssd1306_draw_line(ssd1306_t *p, int32_t x1, int32_t y1, int32_t x2, int32_t y2);
 
+/**
+	@brief draw line on buffer with given draw mode, clipped to the display
+
+	@param[in] p : instance of display
+	@param[in] x1 : x position of starting point
+	@param[in] y1 : y position of starting point
+	@param[in] x2 : x position of end point
+	@param[in] y2 : y position of end point
+	@param[in] mode : set, clear or toggle the pixels
+*/
+void ssd1306_draw_line_with_mode(ssd1306_t *p, int32_t x1, int32_t y1, int32_t x2, int32_t y2, ssd1306_draw_mode_t mode);
+
+/**
+	@brief draw horizontal line, clipped to the display
+
+	@param[in] p : instance of display
+	@param[in] x : x position of starting point
+	@param[in] y : y position of the line
+	@param[in] width : length of the line in pixels
+*/
+void ssd1306_draw_hline(ssd1306_t *p, int32_t x, int32_t y, uint32_t width);
+
+/**
+	@brief draw vertical line, clipped to the display
+
+	@param[in] p : instance of display
+	@param[in] x : x position of the line
+	@param[in] y : y position of starting point
+	@param[in] height : length of the line in pixels
+*/
+void ssd1306_draw_vline(ssd1306_t *p, int32_t x, int32_t y, uint32_t height);
+
 /**
 	@brief draw filled square at given position with given size
 
@@ -0,0 +1,217 @@
+#include <pico/stdlib.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ssd1306.h"
+#include "ssd1306_sim.h"
+
+// bytes taken by a command including its opcode
+static uint8_t ssd1306_sim_cmd_size(uint8_t op) {
+    switch(op) {
+    case SET_CONTRAST:
+    case SET_MEM_ADDR:
+    case SET_MUX_RATIO:
+    case SET_DISP_OFFSET:
+    case SET_COM_PIN_CFG:
+    case SET_DISP_CLK_DIV:
+    case SET_PRECHARGE:
+    case SET_VCOM_DESEL:
+    case SET_CHARGE_PUMP:
+        return 2;
+    case SET_COL_ADDR:
+    case SET_PAGE_ADDR:
+    case 0xA3: // vertical scroll area
+        return 3;
+    case 0x29: // vertical and horizontal scroll
+    case 0x2A:
+        return 6;
+    case 0x26: // horizontal scroll
+    case 0x27:
+        return 7;
+    default:
+        return 1;
+    }
+}
+
+static void ssd1306_sim_exec(ssd1306_sim_t *sim) {
+    const uint8_t *c=sim->cmd;
+
+    switch(c[0]) {
+    case SET_CONTRAST:
+        sim->contrast=c[1];
+        return;
+    case SET_MEM_ADDR:
+        sim->mem_mode=c[1]&3;
+        return;
+    case SET_COL_ADDR:
+        sim->col_start=sim->col=c[1]&0x7F;
+        sim->col_end=c[2]&0x7F;
+        return;
+    case SET_PAGE_ADDR:
+        sim->page_start=sim->page=c[1]&7;
+        sim->page_end=c[2]&7;
+        return;
+    }
+
+    if(c[0]==(SET_DISP|0x00) || c[0]==(SET_DISP|0x01))
+        sim->display_on=c[0]&1;
+    else if(c[0]==SET_ENTIRE_ON || c[0]==(SET_ENTIRE_ON|0x01))
+        sim->entire_on=c[0]&1;
+    else if(c[0]==SET_NORM_INV || c[0]==(SET_NORM_INV|0x01))
+        sim->inverted=c[0]&1;
+    else if(c[0]==SET_SEG_REMAP || c[0]==(SET_SEG_REMAP|0x01))
+        sim->seg_remap=c[0]&1;
+    else if(c[0]==SET_COM_OUT_DIR || c[0]==(SET_COM_OUT_DIR|0x08))
+        sim->com_remap=c[0]&0x08;
+    else if(c[0]<=0x0F && sim->mem_mode==2) // page mode lower column nibble
+        sim->col=(sim->col&0xF0)|c[0];
+    else if(c[0]>=0x10 && c[0]<=0x1F && sim->mem_mode==2) // page mode upper column nibble
+        sim->col=((c[0]&0x07)<<4)|(sim->col&0x0F);
+    else if(c[0]>=0xB0 && c[0]<=0xB7 && sim->mem_mode==2) // page mode page start
+        sim->page=c[0]&7;
+    // everything else (timing, charge pump, scrolling, ...) has no effect on the image
+}
+
+static void ssd1306_sim_command(ssd1306_sim_t *sim, uint8_t val) {
+    if(sim->cmd_len==0)
+        sim->cmd_need=ssd1306_sim_cmd_size(val);
+
+    sim->cmd[sim->cmd_len++]=val;
+    if(sim->cmd_len==sim->cmd_need) {
+        ssd1306_sim_exec(sim);
+        sim->cmd_len=0;
+    }
+}
+
+static void ssd1306_sim_data(ssd1306_sim_t *sim, uint8_t val) {
+    sim->gddram[sim->page][sim->col]=val;
+    ++sim->data_bytes;
+
+    switch(sim->mem_mode) {
+    case 0: // horizontal
+        if(sim->col++>=sim->col_end) {
+            sim->col=sim->col_start;
+            if(sim->page++>=sim->page_end)
+                sim->page=sim->page_start;
+        }
+        break;
+    case 1: // vertical
+        if(sim->page++>=sim->page_end) {
+            sim->page=sim->page_start;
+            if(sim->col++>=sim->col_end)
+                sim->col=sim->col_start;
+        }
+        break;
+    default: // page
+        if(sim->col++>=127)
+            sim->col=0;
+        break;
+    }
+}
+
+void ssd1306_sim_init(ssd1306_sim_t *sim, uint8_t width, uint8_t height, uint8_t address) {
+    memset(sim, 0, sizeof(*sim));
+    sim->address=address;
+    sim->width=width;
+    sim->height=height;
+    sim->mem_mode=2;    // page addressing after reset
+    sim->col_end=127;
+    sim->page_end=7;
+    sim->contrast=0x7F;
+}
+
+void ssd1306_sim_feed(ssd1306_sim_t *sim, const uint8_t *src, size_t len) {
+    ++sim->transactions;
+
+    // each control byte says whether the next byte(s) are data (D/C#) and
+    // whether another control byte follows after one byte (Co)
+    size_t i=0;
+    while(i<len) {
+        uint8_t control=src[i++];
+        bool data=control&0x40;
+        bool single=control&0x80;
+
+        for(; i<len; ++i) {
+            if(data)
+                ssd1306_sim_data(sim, src[i]);
+            else
+                ssd1306_sim_command(sim, src[i]);
+
+            if(single) {
+                ++i;
+                break;
+            }
+        }
+    }
+}
+
+int ssd1306_sim_i2c_device(void *user, i2c_bus_xfer_t *xfer) {
+    ssd1306_sim_t *sim=user;
+    if(xfer->addr!=sim->address || xfer->rx_len>0)
+        return PICO_ERROR_GENERIC;
+
+    ssd1306_sim_feed(sim, xfer->tx, xfer->tx_len);
+    return xfer->tx_len;
+}
+
+bool ssd1306_sim_pixel(const ssd1306_sim_t *sim, uint32_t x, uint32_t y) {
+    if(x>=sim->width || y>=sim->height || !sim->display_on)
+        return false;
+    if(sim->entire_on)
+        return true;
+
+    // 64 pixel wide panels are wired to the middle of the 128 columns
+    uint32_t offset=sim->width==64?32:0;
+    uint32_t col=sim->seg_remap?x:sim->width-1-x;
+    uint32_t row=sim->com_remap?y:sim->height-1-y;
+
+    bool lit=(sim->gddram[row>>3][col+offset]>>(row&7))&1;
+    return lit!=sim->inverted;
+}
+
+bool ssd1306_sim_write_pbm(const ssd1306_sim_t *sim, const char *path) {
+    FILE *f=fopen(path, "wb");
+    if(f==NULL)
+        return false;
+
+    fprintf(f, "P4\n%u %u\n", sim->width, sim->height);
+    for(uint32_t y=0; y<sim->height; ++y) {
+        for(uint32_t x=0; x<sim->width; x+=8) {
+            uint8_t packed=0;
+            for(uint32_t b=0; b<8; ++b)
+                packed|=ssd1306_sim_pixel(sim, x+b, y)<<(7-b);
+            fputc(packed, f);
+        }
+    }
+
+    return fclose(f)==0;
+}
+
+long ssd1306_sim_compare_pbm(const ssd1306_sim_t *sim, const char *path) {
+    FILE *f=fopen(path, "rb");
+    if(f==NULL)
+        return -1;
+
+    unsigned width, height;
+    if(fscanf(f, "P4 %u %u", &width, &height)!=2 || width!=sim->width || height!=sim->height || fgetc(f)==EOF) {
+        fclose(f);
+        return -1;
+    }
+
+    long diff=0;
+    for(uint32_t y=0; y<sim->height; ++y) {
+        for(uint32_t x=0; x<sim->width; x+=8) {
+            int packed=fgetc(f);
+            if(packed==EOF) {
+                fclose(f);
+                return -1;
+            }
+            for(uint32_t b=0; b<8 && x+b<sim->width; ++b)
+                diff+=((packed>>(7-b))&1)!=ssd1306_sim_pixel(sim, x+b, y);
+        }
+    }
+
+    fclose(f);
+    return diff;
+}
@@ -0,0 +1,105 @@
+/** 
+* @file ssd1306_sim.h
+* 
+* host side emulation of an ssd1306 controller: decodes the command/data
+* stream the driver puts on the bus into an emulated display RAM, which can
+* be dumped as a PBM image or compared against a golden image
+*/
+
+#ifndef _inc_ssd1306_sim
+#define _inc_ssd1306_sim
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "i2c_bus.h"
+
+/**
+*	@brief emulated controller state
+*/
+typedef struct {
+    uint8_t address;		/**< i2c address the emulated panel answers on */
+    uint8_t width;			/**< visible width of the panel */
+    uint8_t height;			/**< visible height of the panel */
+    uint8_t gddram[8][128];	/**< display RAM, one byte per column and page */
+    uint8_t mem_mode;		/**< 0 horizontal, 1 vertical, 2 page addressing */
+    uint8_t col_start;		/**< column window */
+    uint8_t col_end;
+    uint8_t page_start;		/**< page window */
+    uint8_t page_end;
+    uint8_t col;			/**< column pointer */
+    uint8_t page;			/**< page pointer */
+    uint8_t contrast;		/**< last contrast set */
+    bool display_on;		/**< SET_DISP|1 received */
+    bool entire_on;			/**< all pixels forced on */
+    bool inverted;			/**< SET_NORM_INV|1 received */
+    bool seg_remap;			/**< column 127 mapped to SEG0 */
+    bool com_remap;			/**< COM scan direction reversed */
+    uint8_t cmd[7];			/**< command being assembled */
+    uint8_t cmd_len;		/**< bytes of cmd received */
+    uint8_t cmd_need;		/**< bytes cmd needs in total */
+    uint32_t transactions;	/**< i2c write transactions decoded */
+    uint32_t data_bytes;	/**< bytes written to display RAM */
+} ssd1306_sim_t;
+
+/**
+*	@brief reset the emulated controller to its power on state
+*
+*	@param[in] sim : emulator instance
+*	@param[in] width : visible width (64 or 128)
+*	@param[in] height : visible height (32 or 64)
+*	@param[in] address : i2c address of the panel
+*/
+void ssd1306_sim_init(ssd1306_sim_t *sim, uint8_t width, uint8_t height, uint8_t address);
+
+/**
+*	@brief decode one i2c write transaction (control byte(s) followed by commands or data)
+*
+*	@param[in] sim : emulator instance
+*	@param[in] src : bytes written after the address byte
+*	@param[in] len : number of bytes
+*/
+void ssd1306_sim_feed(ssd1306_sim_t *sim, const uint8_t *src, size_t len);
+
+/**
+*	@brief device callback for the i2c_bus host transport (i2c_bus_host_device_fn)
+*
+*	@param[in] user : pointer to ssd1306_sim_t
+*	@param[in] xfer : transaction to decode
+*
+*	@return bytes transferred or PICO_ERROR_GENERIC if the address does not match
+*/
+int ssd1306_sim_i2c_device(void *user, i2c_bus_xfer_t *xfer);
+
+/**
+*	@brief what the panel shows at a position, after remapping, inversion and power state
+*
+*	@param[in] sim : emulator instance
+*	@param[in] x : x position
+*	@param[in] y : y position
+*
+*	@return true if the pixel is lit
+*/
+bool ssd1306_sim_pixel(const ssd1306_sim_t *sim, uint32_t x, uint32_t y);
+
+/**
+*	@brief write the visible image as binary PBM (lit pixels are black)
+*
+*	@param[in] sim : emulator instance
+*	@param[in] path : file to write
+*
+*	@return true on success
+*/
+bool ssd1306_sim_write_pbm(const ssd1306_sim_t *sim, const char *path);
+
+/**
+*	@brief compare the visible image with a golden PBM written by ssd1306_sim_write_pbm
+*
+*	@param[in] sim : emulator instance
+*	@param[in] path : golden image
+*
+*	@return number of differing pixels, -1 if the image could not be read or has another size
+*/
+long ssd1306_sim_compare_pbm(const ssd1306_sim_t *sim, const char *path);
+
+#endif
@@ -0,0 +1,50 @@
+#include "task_place.h"
+
+#include <string.h>
+
+const task_place_t *task_place_find(const char *name) {
+    for (uint8_t i = 0; i < task_placement_count; i++) {
+        if (strncmp(task_placement[i].name, name, configMAX_TASK_NAME_LEN) == 0) {
+            return &task_placement[i];
+        }
+    }
+    return NULL;
+}
+
+bool task_place_create(TaskFunction_t task, const char *name, void *params, TaskHandle_t *handle) {
+    const task_place_t *place = task_place_find(name);
+    if (place == NULL || place->stack == 0) {
+        return false;
+    }
+#if TASK_PLACE_AFFINITY
+    // Pinned from creation, it never starts on the wrong core
+    return xTaskCreateAffinitySet(task, name, place->stack, params, place->priority, place->cores, handle) == pdPASS;
+#else
+    return xTaskCreate(task, name, place->stack, params, place->priority, handle) == pdPASS;
+#endif
+}
+
+UBaseType_t task_place_priority(const char *name) {
+    const task_place_t *place = task_place_find(name);
+    configASSERT(place != NULL);  // add the task to task_placement
+    return place != NULL ? place->priority : tskIDLE_PRIORITY + 1;
+}
+
+UBaseType_t task_place_cores(const char *name) {
+    const task_place_t *place = task_place_find(name);
+    configASSERT(place != NULL);  // add the task to task_placement
+    return place != NULL ? place->cores : TASK_PLACE_ANY_CORE;
+}
+
+bool task_place_adopt(const char *name) {
+    const task_place_t *place = task_place_find(name);
+    TaskHandle_t task = xTaskGetHandle(name);
+    if (place == NULL || task == NULL) {
+        return false;
+    }
+    vTaskPrioritySet(task, place->priority);
+#if TASK_PLACE_AFFINITY
+    vTaskCoreAffinitySet(task, place->cores);
+#endif
+    return true;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+/**
+ * Task placement: the core, priority and stack of every task, from one table.
+ *
+ * Each task has an entry in task_placement (src/task_placement.c), looked up by
+ * task name, instead of every xTaskCreate call picking its own numbers. Tasks
+ * of the application are created with task_place_create(). Tasks a library
+ * creates itself get their entry's priority passed to the library's start
+ * function (task_place_priority). Started before the scheduler, they are pinned
+ * right after (task_place_adopt), before they can run anywhere. A task a library
+ * creates once the scheduler runs could start on the wrong core before adopt
+ * gets to it, so its start function takes the entry's cores as well
+ * (task_place_cores) and creates it pinned.
+ *
+ * On the SMP kernel an entry's core mask becomes the task's affinity, on the
+ * single core kernel only the priority and stack apply.
+ *
+ * Interrupts stay on the core that enabled them (irq_set_enabled only touches
+ * the calling core's NVIC), so where a task initialises a driver decides where
+ * the driver's interrupt runs: pinning the task pins its interrupt too.
+ *
+ * cpu_stats prints the load of each core, and for each task the core it last
+ * ran on and how often it moved between cores, to check the table holds up.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#if defined(configNUM_CORES) && configNUM_CORES > 1 && configUSE_CORE_AFFINITY
+#define TASK_PLACE_AFFINITY 1
+#else
+#define TASK_PLACE_AFFINITY 0
+#endif
+
+#define TASK_PLACE_CORE_0 (1u << 0)
+#define TASK_PLACE_CORE_1 (1u << 1)
+#define TASK_PLACE_ANY_CORE (TASK_PLACE_CORE_0 | TASK_PLACE_CORE_1)
+
+typedef struct {
+    const char *name;              // < task name, the key
+    UBaseType_t cores;             // < TASK_PLACE_CORE_* the task may run on
+    UBaseType_t priority;          // < FreeRTOS priority
+    configSTACK_DEPTH_TYPE stack;  // < words, 0 for tasks a library creates with its own stack
+} task_place_t;
+
+/// @brief The placement of every task, see task_placement.c
+extern const task_place_t task_placement[];
+extern const uint8_t task_placement_count;
+
+/// @brief Entry of the task called name
+/// @return NULL if there is none
+const task_place_t *task_place_find(const char *name);
+
+/// @brief Create the task called name with the core, priority and stack of its entry
+/// @return false if it has no entry or could not be created
+bool task_place_create(TaskFunction_t task, const char *name, void *params, TaskHandle_t *handle);
+
+/// @brief Priority of the task called name, for library start functions that create their own task
+/// Every task is expected to have an entry (asserted)
+UBaseType_t task_place_priority(const char *name);
+
+/// @brief Core mask of the task called name, for library start functions that create their own task once the
+/// scheduler runs. Every task is expected to have an entry (asserted)
+UBaseType_t task_place_cores(const char *name);
+
+/// @brief Give the existing task called name the core and priority of its entry, for tasks created elsewhere
+/// @return false if there is no such task or entry
+bool task_place_adopt(const char *name);
@@ -0,0 +1,49 @@
+#include "task_signal.h"
+
+void task_signal_init(task_signal_t *sig, TaskHandle_t consumer) {
+    sig->task = consumer != NULL ? consumer : xTaskGetCurrentTaskHandle();
+}
+
+void task_signal_give(const task_signal_t *sig) {
+    xTaskNotifyGiveIndexed(sig->task, TASK_SIGNAL_NOTIFY_INDEX);
+}
+
+void task_signal_give_from_isr(const task_signal_t *sig, BaseType_t *woken) {
+    vTaskNotifyGiveIndexedFromISR(sig->task, TASK_SIGNAL_NOTIFY_INDEX, woken);
+}
+
+uint32_t task_signal_take(const task_signal_t *sig, TickType_t timeout) {
+    configASSERT(sig->task == xTaskGetCurrentTaskHandle());
+    return ulTaskNotifyTakeIndexed(TASK_SIGNAL_NOTIFY_INDEX, pdTRUE, timeout);
+}
+
+void task_signal_set(const task_signal_t *sig, uint32_t bits) {
+    xTaskNotifyIndexed(sig->task, TASK_SIGNAL_NOTIFY_INDEX, bits, eSetBits);
+}
+
+void task_signal_set_from_isr(const task_signal_t *sig, uint32_t bits, BaseType_t *woken) {
+    xTaskNotifyIndexedFromISR(sig->task, TASK_SIGNAL_NOTIFY_INDEX, bits, eSetBits, woken);
+}
+
+uint32_t task_signal_wait(const task_signal_t *sig, TickType_t timeout) {
+    configASSERT(sig->task == xTaskGetCurrentTaskHandle());
+    uint32_t bits = 0;
+    // Clear on exit only: bits set between the wake up and the clear are taken along
+    if (xTaskNotifyWaitIndexed(TASK_SIGNAL_NOTIFY_INDEX, 0, UINT32_MAX, &bits, timeout) != pdTRUE) {
+        return 0;
+    }
+    return bits;
+}
+
+void task_signal_post(const task_signal_t *sig, uint32_t value) {
+    xTaskNotifyIndexed(sig->task, TASK_SIGNAL_NOTIFY_INDEX, value, eSetValueWithOverwrite);
+}
+
+void task_signal_post_from_isr(const task_signal_t *sig, uint32_t value, BaseType_t *woken) {
+    xTaskNotifyIndexedFromISR(sig->task, TASK_SIGNAL_NOTIFY_INDEX, value, eSetValueWithOverwrite, woken);
+}
+
+bool task_signal_receive(const task_signal_t *sig, uint32_t *value, TickType_t timeout) {
+    configASSERT(sig->task == xTaskGetCurrentTaskHandle());
+    return xTaskNotifyWaitIndexed(TASK_SIGNAL_NOTIFY_INDEX, 0, 0, value, timeout) == pdTRUE;
+}
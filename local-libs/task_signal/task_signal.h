@@ -0,0 +1,66 @@
+#pragma once
+
+/**
+ * Task signals: producer to consumer signalling on a task notification.
+ *
+ * A signal belongs to one consumer task and uses the notification word
+ * TASK_SIGNAL_NOTIFY_INDEX of that task. Signalling writes that word in the
+ * consumer's TCB: no kernel object to create, no item copied, no queue lock,
+ * and the consumer is woken straight away. A signal is used in one of three
+ * ways, never mixed:
+ *
+ *     count  task_signal_give / task_signal_take    every give is counted, none is lost
+ *     bits   task_signal_set / task_signal_wait     bits OR together until the consumer takes them
+ *     value  task_signal_post / task_signal_receive the latest value wins
+ *
+ * Any task can signal, interrupts (on either core) use the *_from_isr variants.
+ * Only the consumer task waits.
+ *
+ * local-libs/rtos_bench compares them with queues and semaphores.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+/// Task notification slot used by signals (slot 1 belongs to the i2c_bus driver)
+#define TASK_SIGNAL_NOTIFY_INDEX 2
+
+typedef struct {
+    TaskHandle_t task;  // < the consumer
+} task_signal_t;
+
+/// @brief Set up a signal to consumer, NULL for the calling task
+void task_signal_init(task_signal_t *sig, TaskHandle_t consumer);
+
+/// @brief Count one event
+void task_signal_give(const task_signal_t *sig);
+
+/// @brief Count one event from an interrupt, woken is set if a yield is due (see portYIELD_FROM_ISR)
+void task_signal_give_from_isr(const task_signal_t *sig, BaseType_t *woken);
+
+/// @brief Consumer side: wait for events and take all of them
+/// @return events given since the last take, 0 on timeout
+uint32_t task_signal_take(const task_signal_t *sig, TickType_t timeout);
+
+/// @brief Set bits
+void task_signal_set(const task_signal_t *sig, uint32_t bits);
+
+/// @brief Set bits from an interrupt, woken is set if a yield is due
+void task_signal_set_from_isr(const task_signal_t *sig, uint32_t bits, BaseType_t *woken);
+
+/// @brief Consumer side: wait for bits and clear them
+/// @return the bits set since the last wait, 0 on timeout
+uint32_t task_signal_wait(const task_signal_t *sig, TickType_t timeout);
+
+/// @brief Replace the value, whether or not the consumer took the last one
+void task_signal_post(const task_signal_t *sig, uint32_t value);
+
+/// @brief Replace the value from an interrupt, woken is set if a yield is due
+void task_signal_post_from_isr(const task_signal_t *sig, uint32_t value, BaseType_t *woken);
+
+/// @brief Consumer side: wait for a value posted since the last receive
+/// @return false on timeout
+bool task_signal_receive(const task_signal_t *sig, uint32_t *value, TickType_t timeout);
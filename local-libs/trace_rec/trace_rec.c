@@ -0,0 +1,160 @@
+#include "trace_rec.h"
+
+#include <hardware/sync.h>
+#include <hardware/timer.h>
+#include <pico/platform.h>
+#include <queue.h>
+#include <stdio.h>
+#include <string.h>
+#include <task.h>
+
+#define EVENTS_PER_LINE 8
+
+typedef struct {
+    trace_rec_entry_t entry[TRACE_REC_EVENTS];
+    volatile uint32_t head;  // < events written since the start, only the core itself writes
+} ring_t;
+
+static ring_t rings[TRACE_REC_CORES];
+static volatile bool recording = false;
+
+// Numbers handed out by the create hooks, 0 stays "unknown"
+static uint16_t task_count = 0;
+static char task_names[TRACE_REC_MAX_TASKS][configMAX_TASK_NAME_LEN];
+static uint16_t queue_count = 0;
+static uint8_t queue_kinds[TRACE_REC_MAX_QUEUES];
+static QueueHandle_t queues[TRACE_REC_MAX_QUEUES];  // < for the registry names, NULL once deleted
+
+static TaskHandle_t capture_task = NULL;
+
+void trace_rec_event(trace_rec_event_t event, uint8_t aux, uint16_t id) {
+    if (!recording) {
+        return;
+    }
+
+    // Masked so an interrupt on this core cannot take the same slot, the other core has its own ring
+    uint32_t irq = save_and_disable_interrupts();
+#if TRACE_REC_CORES > 1
+    ring_t *ring = &rings[portGET_CORE_ID()];
+#else
+    ring_t *ring = &rings[0];
+#endif
+    uint32_t head = ring->head;
+    trace_rec_entry_t *entry = &ring->entry[head & (TRACE_REC_EVENTS - 1)];
+    entry->time_us = time_us_32();
+    entry->event = (uint8_t)event;
+    entry->aux = aux;
+    entry->id = id;
+    __dmb();  // the event is complete before a reader on the other core can count it
+    ring->head = head + 1;
+    restore_interrupts(irq);
+}
+
+void trace_rec_switched(trace_rec_event_t event) {
+    trace_rec_event(event, 0, (uint16_t)uxTaskGetTaskNumber(xTaskGetCurrentTaskHandle()));
+}
+
+void trace_rec_queue(trace_rec_event_t event, void *queue) {
+    trace_rec_event(event, 0, (uint16_t)uxQueueGetQueueNumber((QueueHandle_t)queue));
+}
+
+void trace_rec_isr_enter(void) {
+    trace_rec_event(TRACE_REC_ISR_ENTER, (uint8_t)__get_current_exception(), 0);
+}
+
+// Runs in the kernel's critical section around adding a new task
+void trace_rec_task_created(void *task) {
+    uint16_t number = ++task_count;
+    vTaskSetTaskNumber((TaskHandle_t)task, number);
+    if (number <= TRACE_REC_MAX_TASKS) {
+        strncpy(task_names[number - 1], pcTaskGetName((TaskHandle_t)task), configMAX_TASK_NAME_LEN - 1);
+    }
+}
+
+void trace_rec_queue_created(void *queue) {
+    taskENTER_CRITICAL();  // queues can be created from both cores
+    uint16_t number = ++queue_count;
+    if (number <= TRACE_REC_MAX_QUEUES) {
+        queue_kinds[number - 1] = ucQueueGetQueueType((QueueHandle_t)queue);
+        queues[number - 1] = (QueueHandle_t)queue;
+    }
+    taskEXIT_CRITICAL();
+    vQueueSetQueueNumber((QueueHandle_t)queue, number);
+}
+
+void trace_rec_queue_deleted(void *queue) {
+    UBaseType_t number = uxQueueGetQueueNumber((QueueHandle_t)queue);
+    if (number > 0 && number <= TRACE_REC_MAX_QUEUES) {
+        queues[number - 1] = NULL;
+    }
+}
+
+void trace_rec_start(void) {
+    recording = false;
+    for (uint8_t core = 0; core < TRACE_REC_CORES; core++) {
+        rings[core].head = 0;
+    }
+    __dmb();
+    recording = true;
+}
+
+void trace_rec_stop(void) {
+    recording = false;
+    __dmb();
+}
+
+static void dump_ring(uint8_t core) {
+    const ring_t *ring = &rings[core];
+    uint32_t head = ring->head;
+    // The oldest slot is skipped: the other core may still be finishing a write into it
+    uint32_t first = head > TRACE_REC_EVENTS - 1 ? head - (TRACE_REC_EVENTS - 1) : 0;
+    printf("trace core %u %lu\n", core, (unsigned long)head);
+
+    for (uint32_t i = first; i < head; i++) {
+        if ((i - first) % EVENTS_PER_LINE == 0) {
+            printf(i == first ? "trace ev %u" : "\ntrace ev %u", core);
+        }
+        const trace_rec_entry_t *entry = &ring->entry[i & (TRACE_REC_EVENTS - 1)];
+        printf(" %08lx%02x%02x%04x", (unsigned long)entry->time_us, entry->event, entry->aux, entry->id);
+    }
+    if (head > first) {
+        printf("\n");
+    }
+}
+
+void trace_rec_dump(void) {
+    printf("trace begin %u %lu\n", TRACE_REC_CORES, (unsigned long)time_us_32());
+    for (uint16_t i = 0; i < task_count && i < TRACE_REC_MAX_TASKS; i++) {
+        printf("trace task %u %s\n", i + 1, task_names[i]);
+    }
+    for (uint16_t i = 0; i < queue_count && i < TRACE_REC_MAX_QUEUES; i++) {
+        const char *name = NULL;
+#if configQUEUE_REGISTRY_SIZE > 0
+        if (queues[i] != NULL) {
+            name = pcQueueGetName(queues[i]);
+        }
+#endif
+        printf("trace queue %u %u %s\n", i + 1, queue_kinds[i], name != NULL ? name : "");
+    }
+    for (uint8_t core = 0; core < TRACE_REC_CORES; core++) {
+        dump_ring(core);
+    }
+    printf("trace end\n");
+}
+
+static void trace_rec_capture_task(void *pvParameters) {
+    vTaskDelay(pdMS_TO_TICKS((uint32_t)(uintptr_t)pvParameters));
+    trace_rec_stop();
+    trace_rec_dump();
+    capture_task = NULL;
+    vTaskDelete(NULL);
+}
+
+bool trace_rec_capture(uint32_t duration_ms, UBaseType_t priority) {
+    if (capture_task != NULL) {
+        return false;
+    }
+    trace_rec_start();
+    return xTaskCreate(trace_rec_capture_task, "TRACE_DUMP", 512, (void *)(uintptr_t)duration_ms, priority,
+                       &capture_task) == pdPASS;
+}
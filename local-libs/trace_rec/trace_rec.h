@@ -0,0 +1,61 @@
+#pragma once
+
+/**
+ * Scheduler trace recorder.
+ *
+ * With TRACE_RECORDER=1 the kernel's trace macros (trace_rec_hooks.h) store every
+ * task switch, queue / semaphore / mutex operation, blocking call, notification
+ * and instrumented interrupt as an 8 byte event: a 32 bit microsecond timestamp
+ * (the same clock as cpu_stats), the event, and a task or queue number.
+ *
+ * Each core writes its own ring, with interrupts masked for the few stores of one
+ * event, so recording takes no lock and never waits for the other core. The rings
+ * keep the newest TRACE_REC_EVENTS events each; older ones are overwritten.
+ *
+ * trace_rec_dump() prints the rings as hex lines between "trace begin" and
+ * "trace end", along with the task names and queue kinds. Capture the serial
+ * output and convert it for https://ui.perfetto.dev or chrome://tracing:
+ *
+ *     python3 local-libs/python-scripts/trace_to_perfetto.py serial.log trace.json
+ *
+ * Each core gets a row of the tasks it ran and the interrupts it took, each task
+ * a row of when it ran, was preempted (ready but not running) or blocked, and on
+ * what: a delay, a notification slot (slot 1 is the I2C bus), a queue.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <FreeRTOS.h>
+
+#include "trace_rec_hooks.h"
+
+#ifdef configNUM_CORES
+#define TRACE_REC_CORES configNUM_CORES
+#else
+#define TRACE_REC_CORES 1
+#endif
+
+#define TRACE_REC_EVENTS 1024     // Events kept per core, a power of two (8 bytes each)
+#define TRACE_REC_MAX_TASKS 32    // Task names kept for the dump, later tasks are dumped by number
+#define TRACE_REC_MAX_QUEUES 64   // Queue kinds kept for the dump
+
+typedef struct {
+    uint32_t time_us;  // < time_us_32() when it happened
+    uint8_t event;     // < trace_rec_event_t
+    uint8_t aux;       // < notification index or exception number
+    uint16_t id;       // < task or queue number, 0 if none
+} trace_rec_entry_t;
+
+/// @brief Clear the rings and start recording, works before the scheduler starts
+void trace_rec_start(void);
+
+/// @brief Stop recording, the rings keep what they have until the next start
+void trace_rec_stop(void);
+
+/// @brief Print the rings and names over stdio, stop recording first
+void trace_rec_dump(void);
+
+/// @brief Start recording now and create a task that stops and dumps after duration_ms
+/// @return false if a capture is already running or the task could not be created
+bool trace_rec_capture(uint32_t duration_ms, UBaseType_t priority);
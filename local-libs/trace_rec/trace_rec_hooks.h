@@ -0,0 +1,69 @@
+#pragma once
+
+/**
+ * FreeRTOS trace macros feeding the trace recorder (trace_rec.h).
+ *
+ * Included at the end of FreeRTOSConfig.h when built with TRACE_RECORDER=1, so
+ * the macros expand inside the kernel. Each one is a call that stores an 8 byte
+ * event, nothing is formatted on the target.
+ *
+ * Semaphores and mutexes are queues to the kernel: a give is a send, a take is a
+ * receive, the dump says which kind of queue each number is. Interrupts only show
+ * up when their handler calls traceISR_ENTER() / traceISR_EXIT(), as the I2C bus
+ * handlers do (and the kernel's own tick handler, in ports that call them).
+ */
+
+#include <stdint.h>
+
+typedef enum {
+    TRACE_REC_TASK_IN = 1,        // id: task number
+    TRACE_REC_TASK_OUT,           // id: task number
+    TRACE_REC_QUEUE_SEND,         // id: queue number, a semaphore give or mutex release too
+    TRACE_REC_QUEUE_RECEIVE,      // id: queue number, a semaphore or mutex take too
+    TRACE_REC_QUEUE_SEND_ISR,     // id: queue number
+    TRACE_REC_QUEUE_RECEIVE_ISR,  // id: queue number
+    TRACE_REC_BLOCK_SEND,         // id: queue number, the running task waits for room
+    TRACE_REC_BLOCK_RECEIVE,      // id: queue number, the running task waits for an item
+    TRACE_REC_BLOCK_DELAY,        // the running task sleeps (vTaskDelay, vTaskDelayUntil)
+    TRACE_REC_BLOCK_NOTIFY,       // aux: notification index the running task waits on
+    TRACE_REC_NOTIFY,             // aux: notification index
+    TRACE_REC_NOTIFY_ISR,         // aux: notification index
+    TRACE_REC_ISR_ENTER,          // aux: exception number (IRQ number + 16)
+    TRACE_REC_ISR_EXIT,
+} trace_rec_event_t;
+
+void trace_rec_event(trace_rec_event_t event, uint8_t aux, uint16_t id);
+void trace_rec_switched(trace_rec_event_t event);
+void trace_rec_queue(trace_rec_event_t event, void *queue);
+void trace_rec_task_created(void *task);
+void trace_rec_queue_created(void *queue);
+void trace_rec_queue_deleted(void *queue);
+void trace_rec_isr_enter(void);
+
+#if TRACE_RECORDER
+// traceTASK_SWITCHED_IN is FreeRTOSConfig.h's, shared with cpu_stats
+#define TRACE_REC_SWITCHED_IN()                     trace_rec_switched(TRACE_REC_TASK_IN)
+#define traceTASK_SWITCHED_OUT()                    trace_rec_switched(TRACE_REC_TASK_OUT)
+#define traceTASK_CREATE(pxNewTCB)                  trace_rec_task_created(pxNewTCB)
+#define traceTASK_DELAY()                           trace_rec_event(TRACE_REC_BLOCK_DELAY, 0, 0)
+#define traceTASK_DELAY_UNTIL(xTimeToWake)          trace_rec_event(TRACE_REC_BLOCK_DELAY, 0, 0)
+#define traceTASK_NOTIFY_TAKE_BLOCK(uxIndexToWait)  trace_rec_event(TRACE_REC_BLOCK_NOTIFY, (uint8_t)(uxIndexToWait), 0)
+#define traceTASK_NOTIFY_WAIT_BLOCK(uxIndexToWait)  trace_rec_event(TRACE_REC_BLOCK_NOTIFY, (uint8_t)(uxIndexToWait), 0)
+#define traceTASK_NOTIFY(uxIndexToNotify)           trace_rec_event(TRACE_REC_NOTIFY, (uint8_t)(uxIndexToNotify), 0)
+#define traceTASK_NOTIFY_FROM_ISR(uxIndexToNotify)  trace_rec_event(TRACE_REC_NOTIFY_ISR, (uint8_t)(uxIndexToNotify), 0)
+#define traceTASK_NOTIFY_GIVE_FROM_ISR(uxIndexToNotify) \
+    trace_rec_event(TRACE_REC_NOTIFY_ISR, (uint8_t)(uxIndexToNotify), 0)
+
+#define traceQUEUE_CREATE(pxNewQueue)               trace_rec_queue_created(pxNewQueue)
+#define traceQUEUE_DELETE(pxQueue)                  trace_rec_queue_deleted(pxQueue)
+#define traceQUEUE_SEND(pxQueue)                    trace_rec_queue(TRACE_REC_QUEUE_SEND, pxQueue)
+#define traceQUEUE_RECEIVE(pxQueue)                 trace_rec_queue(TRACE_REC_QUEUE_RECEIVE, pxQueue)
+#define traceQUEUE_SEND_FROM_ISR(pxQueue)           trace_rec_queue(TRACE_REC_QUEUE_SEND_ISR, pxQueue)
+#define traceQUEUE_RECEIVE_FROM_ISR(pxQueue)        trace_rec_queue(TRACE_REC_QUEUE_RECEIVE_ISR, pxQueue)
+#define traceBLOCKING_ON_QUEUE_SEND(pxQueue)        trace_rec_queue(TRACE_REC_BLOCK_SEND, pxQueue)
+#define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue)     trace_rec_queue(TRACE_REC_BLOCK_RECEIVE, pxQueue)
+
+#define traceISR_ENTER()                            trace_rec_isr_enter()
+#define traceISR_EXIT()                             trace_rec_event(TRACE_REC_ISR_EXIT, 0, 0)
+#define traceISR_EXIT_TO_SCHEDULER()                trace_rec_event(TRACE_REC_ISR_EXIT, 0, 0)
+#endif
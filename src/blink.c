@@ -5,6 +5,7 @@
 #include <task.h>
 
 #include "display_run.h"
+#include "task_place.h"
 #include "temp_display_queue.h"
 
 #define MAIN_LED_DELAY 800
@@ -27,15 +28,15 @@ int main() {
 }
 
 void start_tasks() {
-    // Create Your Task
-    xTaskCreate(
+    // Create Your Task - its core, priority and stack depth come from its entry in task_placement.c
+    // (priority: higher the number the more priority, max is configMAX_PRIORITIES - 1 in FreeRTOSConfig.h)
+    bool created = task_place_create(
         led_task,    // Task to be run
-        "LED_TASK",  // Name of the Task for debugging and managing its Task Handle
-        1024,        // Stack depth to be allocated for use with task's stack (see docs)
+        "LED_TASK",  // Name of the Task, also the key of its entry
         NULL,        // Arguments needed by the Task (NULL because we don't have any)
-        1,           // Task Priority - Higher the number the more priority [max is (configMAX_PRIORITIES - 1) provided in FreeRTOSConfig.h]
         NULL         // Task Handle if available for managing the task
     );
+    configASSERT(created);  // false without an entry in task_placement.c or the memory for the task
 
     // Should start you scheduled Tasks (such as the LED_Task above)
     vTaskStartScheduler();
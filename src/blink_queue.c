@@ -1,47 +1,47 @@
 /**
- * Showing the Tasks Queue functionality on FreeRTOS.
- * This example shows how tasks can communicate with one another via Queues
+ * Showing how tasks can signal one another on FreeRTOS.
+ * The LED task tells the USB task about every LED edge. This used to go through a
+ * one item queue, which copies the value and drops an edge sent before the last
+ * one was received. A task signal (task_signal.h) counts the edges on the USB
+ * task's notification instead: nothing is copied and none is lost.
+ * For data bigger than a word, or several consumers, Queues are still the tool.
  * NOTE: This example runs on a single core (Core0)
  */
 
 #include <FreeRTOS.h>
-#include <queue.h>  // Queue functionality from here
 #include <task.h>
 
 #include "pico/cyw43_arch.h"
 #include "pico/stdlib.h"
+#include "task_signal.h"
 
-// Gloabal Queue handle
-static QueueHandle_t xQueue = NULL;
+// LED edges for the USB task, the LED starts OFF and every edge toggles it
+static task_signal_t led_edges;
 
 void led_task_queue(void *pvParameters);  // Task 1
 void usb_task_queue(void *pvParameters);  // Task 2
 
-/// @brief This should be put in main if you want to test the Queue functionality
+/// @brief This should be put in main if you want to test task signalling
 /// @return an int exit code
 int pretend_main_queue() {
     stdio_init_all();  // Initialize
 
-    // Create your Queue
-    xQueue = xQueueCreate(
-        1,            // Length of the Queue (we set one because we only want one item in the Queue)
-        sizeof(uint)  // Size of the item(s) stored
-    );
-
-    // Create Your LED Task
+    // Create Your USB Task, first so the signal knows where to go
+    TaskHandle_t usb_task;
     xTaskCreate(
-        led_task_queue,  // Task to be run
-        "LED_TASK",      // Name of the Task for debugging and managing its Task Handle
+        usb_task_queue,  // Task to be run
+        "USB_TASK",      // Name of the Task for debugging and managing its Task Handle
         256,             // Stack depth to be allocated for use with task's stack (see docs)
         NULL,            // Arguments needed by the Task (NULL because we don't have any)
         1,               // Task Priority - Higher the number the more priority [max is (configMAX_PRIORITIES - 1) provided in FreeRTOSConfig.h]
-        NULL             // Task Handle if available for managing the task
+        &usb_task        // Task Handle, the signal is delivered to it
     );
+    task_signal_init(&led_edges, usb_task);
 
-    // Create Your USB Task
+    // Create Your LED Task
     xTaskCreate(
-        usb_task_queue,  // Task to be run
-        "USB_TASK",      // Name of the Task for debugging and managing its Task Handle
+        led_task_queue,  // Task to be run
+        "LED_TASK",      // Name of the Task for debugging and managing its Task Handle
         256,             // Stack depth to be allocated for use with task's stack (see docs)
         NULL,            // Arguments needed by the Task (NULL because we don't have any)
         1,               // Task Priority - Higher the number the more priority [max is (configMAX_PRIORITIES - 1) provided in FreeRTOSConfig.h]
@@ -65,47 +65,27 @@ void led_task_queue(void *pvParameters) {
         isConnected = false;
     }
 
-    uint uIValueToSend = 0;  // LED Value to be sent to the USB_TASK
-
     while (isConnected) {
         cyw43_arch_gpio_put(CYW43_WL_GPIO_LED_PIN, 1);
-        uIValueToSend = 1;
-        // Sending ON data to the queue
-        xQueueSend(
-            xQueue,          // The queue you created
-            &uIValueToSend,  // Pointer for value to send to the queue
-            0U               // Delay for sending to queue (0 for now since our queue should be empty)
-        );
-        vTaskDelay(100);  // Delay by TICKS defined by FreeRTOS priorities
+        task_signal_give(&led_edges);  // Signal the ON edge, never blocks
+        vTaskDelay(100);               // Delay by TICKS defined by FreeRTOS priorities
 
         cyw43_arch_gpio_put(CYW43_WL_GPIO_LED_PIN, 0);
-        uIValueToSend = 0;
-        // Sending OFF data to the queue
-        xQueueSend(
-            xQueue,          // The queue you created
-            &uIValueToSend,  // Pointer for value to send to the queue
-            0U               // Delay for sending to queue (0 for now since our queue should be empty immediately)
-        );
+        task_signal_give(&led_edges);  // Signal the OFF edge
         vTaskDelay(100);
     }
 }
 
 void usb_task_queue(void *pvParameters) {
-    uint uIReceiveValue;  // Value to retrieve from the Queue
+    bool led_on = false;  // LED state as last reported
 
     while (true) {
-        // Receiving LED data from the queue
-        xQueueReceive(
-            xQueue,           // The queue you created
-            &uIReceiveValue,  // Pointer for value to store the received data from the queue
-            portMAX_DELAY     // Delay for sending to queue (we set max delay to wait for the value)
-        );
-
-        // It may be NULL if no value was written to it. So we check for both scenarios
-        if (uIReceiveValue == 1) {
-            printf("LED Turned ON!\n");
-        } else if (uIReceiveValue == 0) {
-            printf("LED Turned OFF!\n");
+        // Wait for edges, then take all of them (there can be more than one if we were slow)
+        uint32_t edges = task_signal_take(&led_edges, portMAX_DELAY);
+
+        for (; edges > 0; edges--) {
+            led_on = !led_on;
+            printf(led_on ? "LED Turned ON!\n" : "LED Turned OFF!\n");
         }
     }
 }
@@ -0,0 +1,36 @@
+/**
+ * Where every task of the firmware runs (task_place.h).
+ *
+ * Core 0 does the latency sensitive work: ADC sampling (its DMA interrupt is
+ * enabled from main, on core 0), the sensor service, the sampling task, and the
+ * CYW43 driver, whose interrupts stay on the core of the task that called
+ * cyw43_arch_init (the LED tasks). The tick and USB stdio run there too.
+ *
+ * Core 1 renders and flushes the display. Drawing a frame takes milliseconds
+ * and the flush keeps the I2C bus busy for longer, now none of it can delay a
+ * sample. The display bus interrupt is enabled by the display task, so it is
+ * handled on core 1 as well.
+ *
+ * Reporting tasks run wherever there is room.
+ */
+
+#include "task_place.h"
+
+const task_place_t task_placement[] = {
+    // Sensing and network
+    {"ADC_SAMPLER", TASK_PLACE_CORE_0, 2, 0},
+    {"SENSOR_SERVICE", TASK_PLACE_CORE_0, 2, 0},
+    {"SAMPLE_TEMP", TASK_PLACE_CORE_0, 2, 256},  // above the LED task so sampling stays on time
+    {"LED_TRIGGER_TEMP", TASK_PLACE_CORE_0, 1, 256},
+    {"LED_TASK", TASK_PLACE_CORE_0, 1, 1024},  // blink.c
+
+    // Display
+    {"DISPLAY_TEMP", TASK_PLACE_CORE_1, 1, 1024},
+    {"SSD1306_FLUSH", TASK_PLACE_CORE_1, 1, 0},
+
+    // Reporting
+    {"CPU_STATS", TASK_PLACE_ANY_CORE, 3, 0},  // above everything else, a busy loop cannot hide from it
+    {"TRACE_DUMP", TASK_PLACE_ANY_CORE, 3, 0},
+};
+
+const uint8_t task_placement_count = sizeof(task_placement) / sizeof(task_placement[0]);
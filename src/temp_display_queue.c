@@ -3,12 +3,32 @@
  * It is connected to GPI0 4 (for SDA) and GPIO 5 (for SCL)
  * You can change the defined pins in DISPLAY_SDA & DISPLAY_SCL definitions
  *
- * This should do the following in a loop;
- * - Send value to turn ON LED
- * - Calculate temp & voltage
- * - Display on SSD1306
- * - Flash the display
- * - Send value to turn OFF LED
+ * The ADC sampling service converts the temperature sensor non stop (DMA, no CPU)
+ * and averages 4^OVERSAMPLE_BITS conversions per reading, then filters them (spike
+ * rejection, median, EMA). VSYS is read on the side. The sensor service runs the
+ * sensors of the registry (sensor_hal.h): the die temperature, and an AM2320 on
+ * GPIO 10 (SDA) / 11 (SCL) when built with SENSOR_HAL_AM2320=1 (shown as AMB), or
+ * several behind a TCA9548A mux there with SENSOR_HAL_AM2320_MUX (logged). Every
+ * SAMPLE_PERIOD_MS the sampling task takes the newest snapshots, which never waits
+ * for a sensor, and publishes them to a single slot mailbox (xQueueOverwrite).
+ * Every LOG_PERIOD_MS it also prints every sensor of the registry, and the time the
+ * display bus spent on the wire, without waiting for the flush task.
+ *
+ * The display task waits on the mailbox and only redraws when;
+ * - a value moved by more than its resolution (TEMP_RESOLUTION / VOLTAGE_RESOLUTION)
+ * - or nothing was drawn for DISPLAY_MAX_INTERVAL_MS
+ * Redraws are never closer together than DISPLAY_MIN_INTERVAL_MS.
+ * CPU usage and stack high water marks of every task are printed every
+ * CPU_STATS_PERIOD_MS (cpu_stats.h), the first place to look when redraws run late.
+ * Built with TRACE_RECORDER=1, a scheduler trace (trace_rec.h) is dumped after
+ * TRACE_CAPTURE_MS, showing when each task ran, was preempted or waited on I2C.
+ *
+ * Display work runs on one core and sampling, sensors and the CYW43 driver on the
+ * other (task_placement.c), so a blocking frame flush never delays a sample.
+ *
+ * The LED is ON while a frame is being drawn. Each ON and OFF edge is counted on
+ * a task signal (task_signal.h) to the LED task, so none is dropped when the LED
+ * task falls behind.
  */
 
 #include "temp_display_queue.h"
@@ -21,54 +41,139 @@
 #include <queue.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <task.h>
 
+#include "adc_sampler.h"
+#include "cpu_stats.h"
+#include "i2c_bus_rp2040.h"
+#include "sensor_fixed.h"
+#include "sensor_hal.h"
+#include "sensor_hal_am2320.h"
+#include "sensor_hal_die_temp.h"
+#include "sensor_service.h"
 #include "ssd1306.h"
 #include "string_operations.h"
+#include "task_place.h"
+#include "task_signal.h"
+#if TRACE_RECORDER
+#include "trace_rec.h"
+#endif
 
 #define DISPLAY_SDA 4
 #define DISPLAY_SCL 5
 
-static const float CONVERSION_FACTOR = 3.3f / (1 << 12);
+#define SAMPLE_PERIOD_MS 100          // How often a reading is published
+#define ADC_SAMPLE_RATE_HZ 10000      // Free-running ADC rate
+#define OVERSAMPLE_BITS 4             // Each reading averages 4^4 = 256 samples (16 bit result)
+#define VSYS_PERIOD_MS 1000           // How often the supply voltage is read
+#define TEMP_OUTLIER_UV_Q7 (5 * SENSOR_FIXED_DIE_SLOPE_UV * 128)  // Readings jumping 5 C at once are dropped
+#define TEMP_RESOLUTION 50            // Smallest temperature change (centi-degrees C) worth a redraw
+#define VOLTAGE_RESOLUTION 10         // Smallest voltage change (mV) worth a redraw
+#define VSYS_RESOLUTION 50            // Smallest supply voltage change (mV) worth a redraw
+#define AMBIENT_TEMP_RESOLUTION 2     // Smallest ambient temperature change (deci-degrees C) worth a redraw
+#define AMBIENT_HUM_RESOLUTION 10     // Smallest humidity change (deci-percent) worth a redraw
+#define DISPLAY_MIN_INTERVAL_MS 100   // Redraw at most this often
+#define DISPLAY_MAX_INTERVAL_MS 5000  // Redraw at least this often, even without changes
+#define LOG_PERIOD_MS 10000           // How often every sensor is printed
+#define CPU_STATS_PERIOD_MS 5000      // How often CPU usage is printed
+#define TRACE_CAPTURE_MS 3000         // When the scheduler trace is dumped, if built with TRACE_RECORDER=1
+
+typedef struct {
+    int32_t temp;     // < die temperature in centi-degrees C
+    int32_t voltage;  // < sensor voltage in mV
+    int32_t vsys;     // < supply voltage in mV, -1 until the first reading
+    bool has_ambient;  // < an AM2320 sample is below
+    int32_t amb_temp;  // < ambient temperature in deci-degrees C
+    int32_t amb_hum;   // < relative humidity in deci-percent
+} temp_reading_t;
+
+// LED edges, counted on the LED task's notification (the LED starts OFF, every edge toggles it)
+static task_signal_t led_signal;
+
+// Latest reading, a one item queue that is always overwritten
+static QueueHandle_t reading_mailbox = NULL;
+
+// Temperature sensor filters: drop spikes, median of 5, then smooth (alpha 1/8)
+static sensor_filter_outlier_t temp_outlier;
+static sensor_filter_median_t temp_median;
+static sensor_filter_ema_t temp_ema;
+
+// Display bus, transfers run from the I2C interrupt while the task sleeps
+static i2c_bus_t display_bus;
 
-// Gloabal Queue handle
-static QueueHandle_t led_queue = NULL;
+// Registry entries shown on the display, -1 when not built in
+static int die_temp_sensor = -1;
+static int ambient_sensor = -1;
 
-static void on_board_temp_task(void *pvParameters);  // After calc flash LED
+static void on_board_temp_task(void *pvParameters);  // Publishes readings
+static void display_temp_task(void *pvParameters);   // Draws them, flashes LED
 static void led_flash_task(void *pvParameters);
 
 static void setup_display_gpio();
-static void write_temp_to_display(ssd1306_t *disp, float *temp, float *voltage);
-static void send_queue_value(uint *value);
-static void recieve_queue_value(uint *value);
+static void log_sensors();
+static void log_display_bus();
+static void write_temp_to_display(ssd1306_t *disp, const temp_reading_t *reading);
+static bool reading_changed(const temp_reading_t *shown, const temp_reading_t *latest);
 
 void create_temp_display_queue_task() {
-    // Create your Queue
-    led_queue = xQueueCreate(
-        1,            // Length of the Queue (we set one because we only want one item in the Queue)
-        sizeof(uint)  // Size of the item(s) stored
-    );
+    // Start the ADC sampling service (temperature sensor streamed, VSYS on the side)
+    sensor_filter_stage_t *temp_filter[] = {
+        sensor_filter_outlier_init(&temp_outlier, TEMP_OUTLIER_UV_Q7, 3),
+        sensor_filter_median_init(&temp_median, 5),
+        sensor_filter_ema_init(&temp_ema, 3),
+    };
+    adc_sampler_set_filter(ADC_SAMPLER_TEMP, sensor_filter_chain(temp_filter, 3));
 
-    // Create Your Task
-    xTaskCreate(
-        on_board_temp_task,  // Task to be run
-        "DISPLAY_TEMP",      // Name of the Task for debugging and managing its Task Handle
-        1024,                // Stack depth to be allocated for use with task's stack (see docs)
-        NULL,                // Arguments needed by the Task (NULL because we don't have any)
-        1,                   // Task Priority
-        NULL                 // Task Handle if available for managing the task
-    );
+    adc_sampler_config_t sampler = {
+        .input_mask = 1u << ADC_SAMPLER_TEMP,
+        .sample_rate_hz = ADC_SAMPLE_RATE_HZ,
+        .oversample_bits = OVERSAMPLE_BITS,
+        .vsys_period_ms = VSYS_PERIOD_MS,
+        .service_period_ms = SAMPLE_PERIOD_MS / 2,
+        .priority = task_place_priority("ADC_SAMPLER"),
+        .cores = task_place_cores("ADC_SAMPLER"),
+    };
+    adc_sampler_start(&sampler);
 
-    // Create Your Task
-    xTaskCreate(
-        led_flash_task,      // Task to be run
-        "LED_TRIGGER_TEMP",  // Name of the Task for debugging and managing its Task Handle
-        256,                 // Stack depth to be allocated for use with task's stack (see docs)
-        NULL,                // Arguments needed by the Task (NULL because we don't have any)
-        1,                   // Task Priority
-        NULL                 // Task Handle if available for managing the task
+    // And the sensor service on top of it, the die temperature driver would place its own sampler like this one
+    sensor_hal_die_temp_config.priority = sampler.priority;
+    sensor_hal_die_temp_config.cores = sampler.cores;
+    sensor_service_start(task_place_priority("SENSOR_SERVICE"));
+    bool placed = task_place_adopt("SENSOR_SERVICE");  // false if a task is missing or has no entry in task_placement.c
+    configASSERT(placed);
+    die_temp_sensor = sensor_hal_find("die_temp");
+    ambient_sensor = sensor_hal_find("am2320");
+
+    // Create the reading mailbox
+    reading_mailbox = xQueueCreate(
+        1,                      // Only the latest reading matters
+        sizeof(temp_reading_t)  // Size of the item(s) stored
     );
+    vQueueAddToRegistry(reading_mailbox, "reading_mailbox");  // named in debuggers and traces
+
+    // Create the tasks, their core, priority and stack are in task_placement.c
+    placed = task_place_create(on_board_temp_task, "SAMPLE_TEMP", NULL, NULL);
+    configASSERT(placed);
+    placed = task_place_create(display_temp_task, "DISPLAY_TEMP", NULL, NULL);
+    configASSERT(placed);
+
+    TaskHandle_t led_task = NULL;  // the LED edges are signalled to it
+    placed = task_place_create(led_flash_task, "LED_TRIGGER_TEMP", NULL, &led_task);
+    configASSERT(placed && led_task != NULL);
+    task_signal_init(&led_signal, led_task);  // before the scheduler starts, so before any edge
+
+    cpu_stats_start(CPU_STATS_PERIOD_MS, task_place_priority("CPU_STATS"));
+    placed = task_place_adopt("CPU_STATS");
+    configASSERT(placed);
+
+#if TRACE_RECORDER
+    // Records from here on, the newest events are dumped after TRACE_CAPTURE_MS
+    trace_rec_capture(TRACE_CAPTURE_MS, task_place_priority("TRACE_DUMP"));
+    placed = task_place_adopt("TRACE_DUMP");
+    configASSERT(placed);
+#endif
 
     // Should start you scheduled Tasks (such as the LED_Task above)
     vTaskStartScheduler();
@@ -79,34 +184,138 @@ void create_temp_display_queue_task() {
 }
 
 static void on_board_temp_task(void *pvParameters) {
-    adc_init();  // initialize ADC
-    adc_set_temp_sensor_enabled(true);
-    adc_select_input(4);  // Take the fifth channel of the ADC
+    TickType_t last_wake = xTaskGetTickCount();
+    TickType_t last_log = last_wake;
+    uint64_t last_sample_us = 0;
+
+    while (true) {
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(SAMPLE_PERIOD_MS));
+
+        if (last_wake - last_log >= pdMS_TO_TICKS(LOG_PERIOD_MS)) {
+            log_sensors();
+            log_display_bus();
+            last_log = last_wake;
+        }
+
+        sensor_snapshot_t snapshot;
+        if (die_temp_sensor < 0 || !sensor_service_read(die_temp_sensor, &snapshot) ||
+            snapshot.time_us == last_sample_us) {
+            continue;  // nothing new yet
+        }
+        last_sample_us = snapshot.time_us;
+
+        temp_reading_t reading;
+        reading.temp = snapshot.value[SENSOR_DIE_TEMP_TEMP];
+        reading.voltage = snapshot.value[SENSOR_DIE_TEMP_MV];
+        reading.vsys = -1;
+        adc_sampler_sample_t sample;
+        if (adc_sampler_latest(ADC_SAMPLER_VSYS, &sample)) {
+            reading.vsys = sensor_fixed_uv_q7_to_mv(sample.uv_q7 * ADC_SAMPLER_VSYS_DIVIDER);
+        }
+        reading.has_ambient = ambient_sensor >= 0 && sensor_service_read(ambient_sensor, &snapshot);
+        if (reading.has_ambient) {
+            reading.amb_temp = snapshot.value[SENSOR_AM2320_TEMP];
+            reading.amb_hum = snapshot.value[SENSOR_AM2320_HUM];
+        }
+
+        xQueueOverwrite(reading_mailbox, &reading);  // Replace whatever the display has not picked up yet
+    }
+}
+
+// Print every sensor of the registry, whatever it measures
+static void log_sensors() {
+    char line[80];
+    for (uint8_t i = 0; i < sensor_registry_count; i++) {
+        const sensor_driver_t *driver = sensor_registry[i];
+        sensor_snapshot_t snapshot;
+        size_t len = str_append(line, sizeof(line), 0, driver->name);
+        if (sensor_service_read(i, &snapshot)) {
+            for (uint8_t v = 0; v < driver->values; v++) {
+                const sensor_value_info_t *info = &driver->value[v];
+                len = str_append(line, sizeof(line), len, v == 0 ? ": " : ", ");
+                len = str_append(line, sizeof(line), len, info->name);
+                len = str_append(line, sizeof(line), len, " ");
+                int n = fixed_to_str(snapshot.value[v], sensor_unit_decimals(info->unit), line + len, sizeof(line) - len,
+                                     0, ' ');
+                len = str_append(line, sizeof(line), n < 0 ? len : len + n, " ");
+                len = str_append(line, sizeof(line), len, sensor_unit_symbol(info->unit));
+            }
+        } else {
+            len = str_append(line, sizeof(line), len, ": no data");
+        }
+        printf("%s (%lu errors, last %d)\n", line, (unsigned long)snapshot.errors, snapshot.last_error);
+    }
+}
+
+// CPU time given back to other tasks while frames were on the display bus, since the last call. The
+// counters are updated by the bus interrupt, a frame still being flushed is counted by the next call
+static void log_display_bus() {
+    static i2c_bus_stats_t last_stats;
+    i2c_bus_stats_t stats;
+    i2c_bus_get_stats(&display_bus, &stats);
+    uint64_t busy_us = stats.busy_us - last_stats.busy_us;
+    uint64_t isr_us = stats.isr_us - last_stats.isr_us;
+    printf("Display I2C: %llu us on bus, %llu us reclaimed\n", busy_us, busy_us - isr_us);
+    last_stats = stats;
+}
 
+static void display_temp_task(void *pvParameters) {
     // init display
     printf("Configuring GPIO PINS\n");
     setup_display_gpio();
+    i2c_bus_rp2040_init(&display_bus, i2c0);
     ssd1306_t display;
     display.external_vcc = false;
-    ssd1306_init(&display, 128, 64, 0x3C, i2c0);
+    ssd1306_init_with_bus(&display, 128, 64, 0x3C, &display_bus);
+    // Frames are sent by a flush task while we carry on, on this core like the bus interrupt. The scheduler
+    // runs already, so the task is created pinned rather than adopted
+    bool flushing = ssd1306_double_buffer_start(&display, task_place_priority("SSD1306_FLUSH"),
+                                                task_place_cores("SSD1306_FLUSH"));
+    configASSERT(flushing);
 
-    uint ledSendValue = 0;  // LED Value to be sent
+    temp_reading_t latest, shown;
+    bool has_shown = false;
+    TickType_t last_draw = 0;
 
     while (true) {
-        ledSendValue = 1;
-        send_queue_value(&ledSendValue);
-        uint16_t raw = adc_read();  // take the raw value from 5th ADC channel
-        float dieVoltage = raw * CONVERSION_FACTOR;
-        float temp = 27 - (dieVoltage - 0.706) / 0.001721;  // Provided in the Pico datasheet
-        write_temp_to_display(&display, &temp, &dieVoltage);
-        ledSendValue = 0;
-        send_queue_value(&ledSendValue);
-        vTaskDelay(200);
+        // Sleep until a reading arrives (or it is time for the periodic refresh)
+        BaseType_t received = xQueueReceive(reading_mailbox, &latest, pdMS_TO_TICKS(DISPLAY_MAX_INTERVAL_MS));
+        if (received != pdTRUE && !has_shown) {
+            continue;
+        }
+
+        TickType_t since_draw = xTaskGetTickCount() - last_draw;
+        bool stale = since_draw >= pdMS_TO_TICKS(DISPLAY_MAX_INTERVAL_MS);
+        if (has_shown && !stale && !reading_changed(&shown, &latest)) {
+            continue;
+        }
+
+        // Rate limit, then pick up anything newer that came in meanwhile
+        if (has_shown && since_draw < pdMS_TO_TICKS(DISPLAY_MIN_INTERVAL_MS)) {
+            vTaskDelay(pdMS_TO_TICKS(DISPLAY_MIN_INTERVAL_MS) - since_draw);
+            xQueueReceive(reading_mailbox, &latest, 0);
+        }
+
+        task_signal_give(&led_signal);  // ON
+        write_temp_to_display(&display, &latest);
+        shown = latest;
+        has_shown = true;
+        last_draw = xTaskGetTickCount();
+
+        task_signal_give(&led_signal);  // OFF
     }
 
     ssd1306_deinit(&display);
 }
 
+static bool reading_changed(const temp_reading_t *shown, const temp_reading_t *latest) {
+    return abs(latest->temp - shown->temp) >= TEMP_RESOLUTION ||
+           abs(latest->voltage - shown->voltage) >= VOLTAGE_RESOLUTION ||
+           abs(latest->vsys - shown->vsys) >= VSYS_RESOLUTION || latest->has_ambient != shown->has_ambient ||
+           (latest->has_ambient && (abs(latest->amb_temp - shown->amb_temp) >= AMBIENT_TEMP_RESOLUTION ||
+                                    abs(latest->amb_hum - shown->amb_hum) >= AMBIENT_HUM_RESOLUTION));
+}
+
 void led_flash_task(void *pvParameters) {
     bool is_connected = true;
     if (cyw43_arch_init()) {
@@ -114,62 +323,70 @@ void led_flash_task(void *pvParameters) {
         is_connected = false;
     }
 
-    uint ledReceiveValue = 0;  // LED Value to be received
+    bool led_on = false;
 
     while (is_connected) {
-        recieve_queue_value(&ledReceiveValue);
-        if (ledReceiveValue == 1) {
-            cyw43_arch_gpio_put(CYW43_WL_GPIO_LED_PIN, 1);
-            printf("LED tuned ON!\n");
-        } else {
-            cyw43_arch_gpio_put(CYW43_WL_GPIO_LED_PIN, 0);
-            printf("LED turned OFF\n");
+        // Every edge since the last wake up, in order
+        for (uint32_t edges = task_signal_take(&led_signal, portMAX_DELAY); edges > 0; edges--) {
+            led_on = !led_on;
+            cyw43_arch_gpio_put(CYW43_WL_GPIO_LED_PIN, led_on);
+            printf(led_on ? "LED tuned ON!\n" : "LED turned OFF\n");
         }
     }
 }
 
-static void write_temp_to_display(ssd1306_t *disp, float *temp, float *voltage) {
+static void write_temp_to_display(ssd1306_t *disp, const temp_reading_t *reading) {
     ssd1306_clear(disp);
     ssd1306_draw_string(disp, 40, 4, 2, "PICO");
 
-    // temp data
-    char temp_str[4];
-    ftoa(*temp, temp_str, 1);
-    char *temp_full = malloc(sizeof(char) * 20);  // Remember to free this after show
-    if (temp != NULL) {
-        strcpy(temp_full, "Temp: ");
-        strcat(temp_full, temp_str);
-        strcat(temp_full, " C");
-        ssd1306_draw_string(disp, 13, 26, 1, temp_full);
-    } else {
-        ssd1306_draw_string(disp, 13, 26, 1, "NIL");
-    }
+    // temp data, formatted on the stack in tenths of a degree
+    char line[20];
+    size_t len;
+    if (reading != NULL) {
+        // text rows, tighter when there is an ambient line to fit in
+        static const uint8_t rows[] = {26, 38, 52};
+        static const uint8_t rows_ambient[] = {22, 32, 42, 52};
+        const uint8_t *row = reading->has_ambient ? rows_ambient : rows;
+
+        len = str_append(line, sizeof(line), 0, "Temp: ");
+        int n = fixed_to_str(sensor_fixed_div_round(reading->temp, 10), 1, line + len, sizeof(line) - len, 0, ' ');
+        len = str_append(line, sizeof(line), n < 0 ? len : len + n, " C");
+        ssd1306_draw_string(disp, 13, row[0], 1, line);
+
+        // voltage data in hundredths of a volt
+        len = str_append(line, sizeof(line), 0, "RP: ");
+        n = fixed_to_str(sensor_fixed_div_round(reading->voltage, 10), 2, line + len, sizeof(line) - len, 0, ' ');
+        len = str_append(line, sizeof(line), n < 0 ? len : len + n, "V");
+        ssd1306_draw_string(disp, 13, row[1], 1, line);
+
+        // supply voltage, in the place of the package label once it is known
+        if (reading->vsys >= 0) {
+            len = str_append(line, sizeof(line), 0, "VSYS: ");
+            n = fixed_to_str(sensor_fixed_div_round(reading->vsys, 10), 2, line + len, sizeof(line) - len, 0, ' ');
+            len = str_append(line, sizeof(line), n < 0 ? len : len + n, "V");
+            ssd1306_draw_string(disp, 13, row[2], 1, line);
+        } else {
+            ssd1306_draw_string(disp, 13, row[2], 1, "RP2040 PACKAGE");
+        }
 
-    // voltage data
-    char voltage_str[4];
-    ftoa(*voltage, voltage_str, 2);
-    char *volt_full = malloc(sizeof(char) * 20);  // Remember to free this after show
-    if (temp != NULL) {
-        strcpy(volt_full, "RP: ");
-        strcat(volt_full, voltage_str);
-        strcat(volt_full, "V");
-        ssd1306_draw_string(disp, 13, 38, 1, volt_full);
+        // ambient temperature and humidity, both in tenths
+        if (reading->has_ambient) {
+            len = str_append(line, sizeof(line), 0, "AMB: ");
+            n = fixed_to_str(reading->amb_temp, 1, line + len, sizeof(line) - len, 0, ' ');
+            len = str_append(line, sizeof(line), n < 0 ? len : len + n, "C ");
+            n = fixed_to_str(reading->amb_hum, 1, line + len, sizeof(line) - len, 0, ' ');
+            len = str_append(line, sizeof(line), n < 0 ? len : len + n, "%");
+            ssd1306_draw_string(disp, 13, row[3], 1, line);
+        }
     } else {
+        ssd1306_draw_string(disp, 13, 26, 1, "NIL");
         ssd1306_draw_string(disp, 13, 38, 1, "NIL");
+        ssd1306_draw_string(disp, 13, 52, 1, "RP2040 PACKAGE");
     }
 
     // ssd1306_draw_string(disp, 13, 32, 1, "C..");
     // ssd1306_draw_string(disp, 13, 42, 1, "Package Temp");
-    ssd1306_draw_string(disp, 13, 52, 1, "RP2040 PACKAGE");
     ssd1306_show(disp);
-
-    free(temp_full);  // temp mem freed here
-    free(volt_full);  // volt mem freed here
-
-    vTaskDelay(2000);
-    ssd1306_poweroff(disp);
-    vTaskDelay(200);
-    ssd1306_poweron(disp);
 }
 
 static void setup_display_gpio() {
@@ -179,21 +396,3 @@ static void setup_display_gpio() {
     gpio_pull_up(DISPLAY_SDA);
     gpio_pull_up(DISPLAY_SCL);
 }
-
-static void send_queue_value(uint *value) {
-    // Sending ON data to the queue
-    xQueueSend(
-        led_queue,  // The queue you created
-        value,      // Pointer for value to send to the queue
-        0U          // Delay for sending to queue (0 for now since our queue should be empty)
-    );
-}
-
-static void recieve_queue_value(uint *value) {
-    // Receiving LED data from the queue
-    xQueueReceive(
-        led_queue,     // The queue you created
-        value,         // Pointer for value to store the received data from the queue
-        portMAX_DELAY  // Delay for sending to queue (we set max delay to wait for the value)
-    );
-}
@@ -0,0 +1,32 @@
+#pragma once
+
+/**
+ * Timing for the host benchmarks (bench_*.c, run by hand, not by ctest).
+ *
+ * Host numbers only say how two ways of doing the same thing compare on a desktop
+ * CPU; on the RP2040 (no cache, no FPU, no divide instruction) the ratios differ,
+ * usually in favour of the integer and byte-wide paths.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+static inline uint64_t bench_now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+/// Runs body iterations times and prints the mean time of one run. The memory
+/// clobber keeps the compiler from hoisting or dropping the work.
+#define BENCH(name, iterations, body)                                                    \
+    do {                                                                                 \
+        uint64_t bench_start = bench_now_ns();                                           \
+        for (long bench_i = 0; bench_i < (iterations); bench_i++) {                      \
+            body;                                                                        \
+            __asm__ volatile("" ::: "memory");                                           \
+        }                                                                                \
+        double bench_ns = (double)(bench_now_ns() - bench_start) / (iterations);         \
+        printf("%-48s %10.1f ns\n", name, bench_ns);                                     \
+    } while (0)
@@ -0,0 +1,41 @@
+/**
+ * CRC16/Modbus: the 256 and 16 entry tables (crc16_both.h) against the bit by bit
+ * loop, for an AM2320 reply and a longer buffer.
+ */
+
+#include "bench.h"
+#include "crc16_both.h"
+
+#define ITERATIONS 2000000
+
+static uint16_t crc16_bitwise(const uint8_t *buf, size_t len) {
+    uint16_t crc = CRC16_MODBUS_INIT;
+    while (len--) {
+        crc ^= *buf++;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = crc & 1 ? (crc >> 1) ^ 0xA001 : crc >> 1;
+        }
+    }
+    return crc;
+}
+
+static volatile uint16_t sink;
+
+int main(void) {
+    static uint8_t frame[6] = {0x03, 0x04, 0x01, 0xF4, 0x00, 0xFA};
+    static uint8_t block[256];
+    for (size_t i = 0; i < sizeof(block); i++) {
+        block[i] = (uint8_t)(i * 37 + 11);
+    }
+
+    printf("CRC16/Modbus (time per buffer)\n");
+
+    BENCH("AM2320 reply (6 bytes), 256 entry table", ITERATIONS, sink = crc16_byte(frame, sizeof(frame)));
+    BENCH("  16 entry table", ITERATIONS, sink = crc16_nibble(frame, sizeof(frame)));
+    BENCH("  bit by bit", ITERATIONS, sink = crc16_bitwise(frame, sizeof(frame)));
+    BENCH("256 bytes, 256 entry table", ITERATIONS / 20, sink = crc16_byte(block, sizeof(block)));
+    BENCH("  16 entry table", ITERATIONS / 20, sink = crc16_nibble(block, sizeof(block)));
+    BENCH("  bit by bit", ITERATIONS / 20, sink = crc16_bitwise(block, sizeof(block)));
+
+    return 0;
+}
@@ -0,0 +1,97 @@
+/**
+ * Sensor filter stages, time per sample, on noisy input around 20000. The moving
+ * average and median are also timed against the plain ways of getting the same
+ * result (summing / sorting the whole window every sample), the chain is the
+ * firmware's temperature filter.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "sensor_filter.h"
+
+#define ITERATIONS 2000000
+#define INPUTS 4096  // < a power of two
+
+static int32_t inputs[INPUTS];
+static int32_t window[SENSOR_FILTER_MAVG_MAX];
+static int32_t sorted[SENSOR_FILTER_MEDIAN_MAX];
+static volatile int32_t sink;
+
+static void plain_mavg(int32_t in, uint16_t len, long i) {
+    window[i % len] = in;
+    int64_t sum = 0;
+    for (uint16_t k = 0; k < len; k++) {
+        sum += window[k];
+    }
+    sink = (int32_t)(sum / len);
+}
+
+static void plain_median(int32_t in, uint8_t len, long i) {
+    window[i % len] = in;
+    memcpy(sorted, window, len * sizeof(int32_t));
+    for (uint8_t a = 1; a < len; a++) {
+        int32_t v = sorted[a];
+        uint8_t b = a;
+        for (; b > 0 && sorted[b - 1] > v; b--) {
+            sorted[b] = sorted[b - 1];
+        }
+        sorted[b] = v;
+    }
+    sink = sorted[len / 2];
+}
+
+static void stage(sensor_filter_stage_t *s, int32_t in) {
+    int32_t out;
+    if (sensor_filter_run(s, in, &out)) {
+        sink = out;
+    }
+}
+
+int main(void) {
+    sensor_filter_mavg_t mavg8, mavg64;
+    sensor_filter_median_t median5, median15;
+    sensor_filter_ema_t ema;
+    sensor_filter_outlier_t outlier;
+    sensor_filter_decimate_t decimate;
+
+    srand(1);
+    for (int i = 0; i < INPUTS; i++) {
+        inputs[i] = 20000 + rand() % 201 - 100 + (i % 61 == 0 ? 5000 : 0);
+    }
+    sensor_filter_mavg_init(&mavg8, 8);
+    sensor_filter_mavg_init(&mavg64, 64);
+    sensor_filter_median_init(&median5, 5);
+    sensor_filter_median_init(&median15, 15);
+    sensor_filter_ema_init(&ema, 3);
+    sensor_filter_outlier_init(&outlier, 1000, 3);
+    sensor_filter_decimate_init(&decimate, 4);
+
+    printf("sensor filter stages (time per sample)\n");
+
+    BENCH("mavg 8", ITERATIONS, stage(&mavg8.stage, inputs[bench_i & (INPUTS - 1)]));
+    BENCH("  summing the window", ITERATIONS, plain_mavg(inputs[bench_i & (INPUTS - 1)], 8, bench_i));
+    BENCH("mavg 64", ITERATIONS, stage(&mavg64.stage, inputs[bench_i & (INPUTS - 1)]));
+    BENCH("  summing the window", ITERATIONS, plain_mavg(inputs[bench_i & (INPUTS - 1)], 64, bench_i));
+    BENCH("median 5", ITERATIONS, stage(&median5.stage, inputs[bench_i & (INPUTS - 1)]));
+    BENCH("  sorting the window", ITERATIONS, plain_median(inputs[bench_i & (INPUTS - 1)], 5, bench_i));
+    BENCH("median 15", ITERATIONS, stage(&median15.stage, inputs[bench_i & (INPUTS - 1)]));
+    BENCH("  sorting the window", ITERATIONS, plain_median(inputs[bench_i & (INPUTS - 1)], 15, bench_i));
+    BENCH("ema shift 3", ITERATIONS, stage(&ema.stage, inputs[bench_i & (INPUTS - 1)]));
+    BENCH("outlier 1000, 3 rejects", ITERATIONS, stage(&outlier.stage, inputs[bench_i & (INPUTS - 1)]));
+    BENCH("decimate 4", ITERATIONS, stage(&decimate.stage, inputs[bench_i & (INPUTS - 1)]));
+
+    sensor_filter_outlier_t temp_outlier;
+    sensor_filter_median_t temp_median;
+    sensor_filter_ema_t temp_ema;
+    sensor_filter_stage_t *temp_filter[] = {
+        sensor_filter_outlier_init(&temp_outlier, 1000, 3),
+        sensor_filter_median_init(&temp_median, 5),
+        sensor_filter_ema_init(&temp_ema, 3),
+    };
+    sensor_filter_stage_t *chain = sensor_filter_chain(temp_filter, 3);
+    BENCH("outlier -> median 5 -> ema 3", ITERATIONS, stage(chain, inputs[bench_i & (INPUTS - 1)]));
+
+    return 0;
+}
@@ -0,0 +1,77 @@
+/**
+ * The integer sensor conversions (sensor_fixed.h), time per sample, against the
+ * float formulas they replaced: die temperature from an ADC count, an oversampled
+ * reading with 4 extra bits to millivolts, and the AM2320 temperature and
+ * humidity words. The inputs cycle through a table so nothing is folded away.
+ *
+ * A desktop FPU runs the float formulas in a few cycles, so here they tend to win;
+ * the RP2040 has no FPU and no divide instruction, its soft float add, multiply
+ * and divide cost tens of cycles each. Multiply by the clock (GHz) for cycles.
+ */
+
+#include <stdlib.h>
+
+#include "bench.h"
+#include "sensor_fixed.h"
+
+#define ITERATIONS 20000000
+#define INPUTS 4096  // < a power of two
+#define EXTRA_BITS 4
+
+static uint16_t counts[INPUTS];
+static uint32_t oversampled[INPUTS];
+static uint16_t am2320_temp[INPUTS];
+static uint16_t am2320_hum[INPUTS];
+static volatile int32_t sink;
+static volatile float sink_float;
+
+static const float CONVERSION_FACTOR = 3.3f / (1 << 12);
+
+// As the display task did: volts, then 27 - (V - 0.706) / 0.001721
+static float float_die_temp(uint16_t raw) {
+    float voltage = raw * CONVERSION_FACTOR;
+    return 27 - (voltage - 0.706) / 0.001721;
+}
+
+static float float_oversampled_mv(uint32_t value) {
+    return value * (3300.0f / (1 << (12 + EXTRA_BITS)));
+}
+
+static void fixed_am2320(long i) {
+    sink = sensor_fixed_am2320_temp_deci_c(am2320_temp[i]);
+    sink = sensor_fixed_am2320_hum_deci_pct(am2320_hum[i]);
+}
+
+// As am2320.c did: sign-magnitude word, then tenths
+static void float_am2320(long i) {
+    uint16_t t = am2320_temp[i];
+    float value = (t & 0x8000) ? -(int16_t)(t & 0x7fff) : (int16_t)t;
+    sink_float = value / 10.0;
+    sink_float = am2320_hum[i] / 10.0;
+}
+
+int main(void) {
+    srand(12);
+    for (int i = 0; i < INPUTS; i++) {
+        counts[i] = (uint16_t)(860 + rand() % 32);  // around 20 C
+        oversampled[i] = (uint32_t)counts[i] << EXTRA_BITS | (uint32_t)(rand() & ((1 << EXTRA_BITS) - 1));
+        am2320_temp[i] = (uint16_t)((rand() & 1 ? 0x8000 : 0) | (rand() % 400));
+        am2320_hum[i] = (uint16_t)(rand() % 1000);
+    }
+
+    printf("Sensor conversions (time per sample)\n");
+
+    BENCH("die temperature, fixed point (centi-C)", ITERATIONS,
+          sink = sensor_fixed_die_temp_centi_c(sensor_fixed_adc_to_uv_q7(counts[bench_i & (INPUTS - 1)])));
+    BENCH("  float", ITERATIONS, sink_float = float_die_temp(counts[bench_i & (INPUTS - 1)]));
+
+    BENCH("oversampled (+4 bits) to mV, fixed point", ITERATIONS,
+          sink = sensor_fixed_uv_q7_to_mv(
+              sensor_fixed_adc_oversampled_to_uv_q7(oversampled[bench_i & (INPUTS - 1)], EXTRA_BITS)));
+    BENCH("  float", ITERATIONS, sink_float = float_oversampled_mv(oversampled[bench_i & (INPUTS - 1)]));
+
+    BENCH("AM2320 temperature and humidity, fixed point", ITERATIONS, fixed_am2320(bench_i & (INPUTS - 1)));
+    BENCH("  float", ITERATIONS, float_am2320(bench_i & (INPUTS - 1)));
+
+    return 0;
+}
@@ -0,0 +1,63 @@
+/**
+ * ssd1306 drawing: the driver's page-byte paths against the per-pixel reference
+ * (ssd1306_reference.h) on a 128x64 buffer.
+ *
+ * ssd1306.c is included to reach its static rectangle fill. Lines are timed against
+ * the old float slope line, which cannot clip, so the clipped cases only run in the
+ * driver. Text is timed against the per-pixel glyph drawing at a page aligned y
+ * and at one that straddles two pages.
+ */
+
+#include <stdlib.h>
+
+#include "../../local-libs/ssd1306/ssd1306.c"
+#include "bench.h"
+#include "ssd1306_reference.h"
+
+#define ITERATIONS 200000
+
+static ssd1306_t disp;
+
+int main(void) {
+    disp.width = 128;
+    disp.height = 64;
+    disp.pages = 8;
+    disp.bufsize = 128 * 8;
+    disp.buffer = calloc(1, disp.bufsize);
+    ssd1306_mark_clean(&disp);
+
+    printf("ssd1306 drawing, 128x64 (time per call)\n");
+
+    BENCH("fill_rect whole panel, set", ITERATIONS, ssd1306_fill_rect(&disp, 0, 0, 128, 64, SSD1306_DRAW_SET));
+    BENCH("  per pixel", ITERATIONS / 10, ref_fill_rect(&disp, 0, 0, 128, 64, SSD1306_DRAW_SET));
+    BENCH("fill_rect 40x20 across pages, set", ITERATIONS, ssd1306_fill_rect(&disp, 30, 5, 40, 20, SSD1306_DRAW_SET));
+    BENCH("  per pixel", ITERATIONS, ref_fill_rect(&disp, 30, 5, 40, 20, SSD1306_DRAW_SET));
+    BENCH("fill_rect 40x20 across pages, clear", ITERATIONS,
+          ssd1306_fill_rect(&disp, 30, 5, 40, 20, SSD1306_DRAW_CLEAR));
+    BENCH("  per pixel", ITERATIONS, ref_fill_rect(&disp, 30, 5, 40, 20, SSD1306_DRAW_CLEAR));
+    BENCH("fill_rect 40x20 across pages, xor", ITERATIONS, ssd1306_fill_rect(&disp, 30, 5, 40, 20, SSD1306_DRAW_XOR));
+    BENCH("  per pixel", ITERATIONS, ref_fill_rect(&disp, 30, 5, 40, 20, SSD1306_DRAW_XOR));
+    BENCH("draw_hline 120 px", ITERATIONS, ssd1306_draw_hline(&disp, 4, 33, 120));
+    BENCH("  per pixel", ITERATIONS, ref_fill_rect(&disp, 4, 33, 120, 1, SSD1306_DRAW_SET));
+    BENCH("draw_vline 60 px", ITERATIONS, ssd1306_draw_vline(&disp, 64, 2, 60));
+    BENCH("  per pixel", ITERATIONS, ref_fill_rect(&disp, 64, 2, 1, 60, SSD1306_DRAW_SET));
+    BENCH("draw_line diagonal 127x63", ITERATIONS, ssd1306_draw_line(&disp, 0, 0, 127, 63));
+    BENCH("  float slope", ITERATIONS, ref_line_float(&disp, 0, 0, 127, 63));
+    BENCH("draw_line steep 10x63", ITERATIONS, ssd1306_draw_line(&disp, 60, 0, 70, 63));
+    BENCH("  float slope (10 px, gaps)", ITERATIONS, ref_line_float(&disp, 60, 0, 70, 63));
+    BENCH("draw_line clipped, both ends off panel", ITERATIONS, ssd1306_draw_line(&disp, -200, -50, 300, 120));
+    BENCH("draw_line clipped, int32 extremes", ITERATIONS,
+          ssd1306_draw_line(&disp, INT32_MIN, 1, INT32_MAX, 62));
+    BENCH("draw_line wholly outside", ITERATIONS, ssd1306_draw_line(&disp, 130, -20, 200, 20));
+    BENCH("draw_string 20 chars, y=8", ITERATIONS, ssd1306_draw_string(&disp, 2, 8, 1, "Temp 23.45C Vsys 5.0"));
+    BENCH("  per pixel", ITERATIONS / 10, ref_draw_string(&disp, 2, 8, 1, font_8x5, "Temp 23.45C Vsys 5.0"));
+    BENCH("draw_string 20 chars, y=11", ITERATIONS, ssd1306_draw_string(&disp, 2, 11, 1, "Temp 23.45C Vsys 5.0"));
+    BENCH("  per pixel", ITERATIONS / 10, ref_draw_string(&disp, 2, 11, 1, font_8x5, "Temp 23.45C Vsys 5.0"));
+    BENCH("draw_string 10 chars scale 2, y=11", ITERATIONS, ssd1306_draw_string(&disp, 2, 11, 2, "23.45 C  %"));
+    BENCH("  per pixel", ITERATIONS / 10, ref_draw_string(&disp, 2, 11, 2, font_8x5, "23.45 C  %"));
+    BENCH("draw_char, y=11", ITERATIONS, ssd1306_draw_char(&disp, 40, 11, 1, 'W'));
+    BENCH("  per pixel", ITERATIONS, ref_draw_char(&disp, 40, 11, 1, font_8x5, 'W'));
+
+    free(disp.buffer);
+    return 0;
+}
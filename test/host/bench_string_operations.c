@@ -0,0 +1,40 @@
+/**
+ * Display line formatting: fixed_to_str and str_append against the float paths
+ * they replaced (ftoa and snprintf) for the values the screens show.
+ */
+
+#include <string.h>
+
+#include "bench.h"
+#include "string_operations.h"
+
+#define ITERATIONS 1000000
+
+int main(void) {
+    char line[24];
+    volatile int32_t centi = -2345;  // < -23.45, volatile so no call is folded away
+    volatile float value = -23.45f;
+    size_t len;
+
+    printf("display line formatting (time per call)\n");
+
+    BENCH("fixed_to_str -23.45, 2 decimals", ITERATIONS, fixed_to_str(centi, 2, line, sizeof(line), 0, ' '));
+    BENCH("  snprintf %.2f", ITERATIONS, snprintf(line, sizeof(line), "%.2f", (double)value));
+    BENCH("  ftoa", ITERATIONS, ftoa(value, line, 2));
+    BENCH("fixed_to_str padded to 8", ITERATIONS, fixed_to_str(centi, 2, line, sizeof(line), 8, ' '));
+    BENCH("  snprintf %8.2f", ITERATIONS, snprintf(line, sizeof(line), "%8.2f", (double)value));
+    BENCH("str_append \"Temp: \"", ITERATIONS, str_append(line, sizeof(line), 0, "Temp: "));
+    BENCH("\"Temp: -23.4 C\" with the helpers", ITERATIONS, {
+        len = str_append(line, sizeof(line), 0, "Temp: ");
+        int n = fixed_to_str(centi / 10, 1, line + len, sizeof(line) - len, 0, ' ');
+        str_append(line, sizeof(line), n < 0 ? len : len + n, " C");
+    });
+    BENCH("  snprintf \"Temp: %.1f C\"", ITERATIONS, snprintf(line, sizeof(line), "Temp: %.1f C", (double)value));
+    BENCH("  ftoa and strcat", ITERATIONS, {
+        strcpy(line, "Temp: ");
+        ftoa(value, line + 6, 1);
+        strcat(line, " C");
+    });
+
+    return 0;
+}
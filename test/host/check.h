@@ -0,0 +1,30 @@
+#pragma once
+
+/**
+ * Checks for the host unit tests. A failed check prints where it is and the test
+ * carries on; main returns CHECK_RESULT() so ctest sees the failure.
+ */
+
+#include <stdio.h>
+
+static int check_failures = 0;
+
+#define CHECK(cond)                                                                  \
+    do {                                                                             \
+        if (!(cond)) {                                                               \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+            check_failures++;                                                        \
+        }                                                                            \
+    } while (0)
+
+#define CHECK_EQ(actual, expected)                                                                       \
+    do {                                                                                                 \
+        long long check_a = (long long)(actual), check_e = (long long)(expected);                        \
+        if (check_a != check_e) {                                                                        \
+            fprintf(stderr, "%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, #actual, check_a, \
+                    check_e);                                                                            \
+            check_failures++;                                                                            \
+        }                                                                                                \
+    } while (0)
+
+#define CHECK_RESULT() (check_failures == 0 ? 0 : (fprintf(stderr, "%d checks failed\n", check_failures), 1))
@@ -0,0 +1,29 @@
+#pragma once
+
+/**
+ * Both CRC16/Modbus table variants of crc16.c in one program: the source is
+ * included twice with CRC16_MODBUS_NIBBLE_TABLE off and on, each time with its
+ * table and functions renamed.
+ *
+ *   crc16_byte_update / crc16_byte    256 entry table
+ *   crc16_nibble_update / crc16_nibble   16 entry table
+ */
+
+#define CRC16_MODBUS_NIBBLE_TABLE 0
+#define crc16_table crc16_byte_table
+#define crc16_modbus_update crc16_byte_update
+#define crc16_modbus crc16_byte
+#include "../../local-libs/helpers/crc16.c"
+#undef crc16_table
+#undef crc16_modbus_update
+#undef crc16_modbus
+
+#undef CRC16_MODBUS_NIBBLE_TABLE
+#define CRC16_MODBUS_NIBBLE_TABLE 1
+#define crc16_table crc16_nibble_table
+#define crc16_modbus_update crc16_nibble_update
+#define crc16_modbus crc16_nibble
+#include "../../local-libs/helpers/crc16.c"
+#undef crc16_table
+#undef crc16_modbus_update
+#undef crc16_modbus
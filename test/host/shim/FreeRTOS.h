@@ -0,0 +1,39 @@
+#pragma once
+
+/**
+ * Just enough of FreeRTOS for the host unit tests (test/host), not a port.
+ *
+ * There is one task context and no scheduler: the code under test sees the
+ * scheduler as not started unless a test sets shim_scheduler_running. Task
+ * notifications are plain counters, so a wait only works once the notification
+ * has been given (a wait that would block aborts the test). Tasks and
+ * semaphores cannot be created.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+
+#define pdFALSE ((BaseType_t)0)
+#define pdTRUE ((BaseType_t)1)
+#define pdFAIL pdFALSE
+#define pdPASS pdTRUE
+#define portMAX_DELAY ((TickType_t)0xffffffffu)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+#define configSTACK_DEPTH_TYPE uint32_t
+#define configTICK_RATE_HZ ((TickType_t)1000)  // as in configs/FreeRTOS-Kernel/FreeRTOSConfig.h
+
+// Checked in every build type
+void shim_assert_failed(const char *file, int line);
+#define configASSERT(x)                             \
+    do {                                            \
+        if (!(x)) {                                 \
+            shim_assert_failed(__FILE__, __LINE__); \
+        }                                           \
+    } while (0)
+
+#define portYIELD_FROM_ISR(woken) (void)(woken)
@@ -0,0 +1,11 @@
+#pragma once
+
+#include "pico/stdlib.h"
+
+/// There are no interrupts to mask
+static inline uint32_t save_and_disable_interrupts(void) {
+    return 0;
+}
+
+static inline void restore_interrupts(uint32_t status) {
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "pico/error.h"
+
+typedef unsigned int uint;
+
+#define _u(x) x##u  // hardware/platform_defs.h
+
+/// Microseconds of the host's monotonic clock plus shim_time_offset_us
+uint64_t time_us_64(void);
+uint32_t time_us_32(void);
+
+/// Added to the clock, lets a test skip ahead without waiting
+extern uint64_t shim_time_offset_us;
+
+/// Set by a test to stop the host's clock: time is then shim_time_offset_us alone and only moves with it
+extern bool shim_time_stopped;
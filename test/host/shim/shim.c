@@ -0,0 +1,113 @@
+#include <FreeRTOS.h>
+#include <hardware/i2c.h>
+#include <pico/stdlib.h>
+#include <queue.h>
+#include <semphr.h>
+#include <stdlib.h>
+#include <task.h>
+#include <time.h>
+
+// Slots as in configs/FreeRTOS-Kernel/FreeRTOSConfig.h (configTASK_NOTIFICATION_ARRAY_ENTRIES)
+#define SHIM_NOTIFY_SLOTS 3
+
+struct shim_task {
+    uint32_t notify[SHIM_NOTIFY_SLOTS];
+};
+
+static struct shim_task the_task;
+
+BaseType_t shim_scheduler_running = pdFALSE;
+uint64_t shim_time_offset_us = 0;
+bool shim_time_stopped = false;
+
+void shim_assert_failed(const char *file, int line) {
+    fprintf(stderr, "%s:%d: configASSERT failed\n", file, line);
+    abort();
+}
+
+uint64_t time_us_64(void) {
+    if (shim_time_stopped) {
+        return shim_time_offset_us;
+    }
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000u + (uint64_t)now.tv_nsec / 1000u + shim_time_offset_us;
+}
+
+uint32_t time_us_32(void) {
+    return (uint32_t)time_us_64();
+}
+
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop) {
+    return PICO_ERROR_GENERIC;
+}
+
+int i2c_read_blocking(i2c_inst_t *i2c, uint8_t addr, uint8_t *dst, size_t len, bool nostop) {
+    return PICO_ERROR_GENERIC;
+}
+
+BaseType_t xTaskGetSchedulerState(void) {
+    return shim_scheduler_running ? taskSCHEDULER_RUNNING : taskSCHEDULER_NOT_STARTED;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    return &the_task;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char *name, configSTACK_DEPTH_TYPE stack, void *params,
+                       UBaseType_t priority, TaskHandle_t *created) {
+    return pdFAIL;
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    abort();  // no task can have been created
+}
+
+BaseType_t xTaskNotifyStateClearIndexed(TaskHandle_t task, UBaseType_t index) {
+    return pdFALSE;
+}
+
+BaseType_t xTaskNotifyGiveIndexed(TaskHandle_t task, UBaseType_t index) {
+    configASSERT(index < SHIM_NOTIFY_SLOTS);
+    task->notify[index]++;
+    return pdPASS;
+}
+
+void vTaskNotifyGiveIndexedFromISR(TaskHandle_t task, UBaseType_t index, BaseType_t *woken) {
+    xTaskNotifyGiveIndexed(task, index);
+    if (woken != NULL) {
+        *woken = pdTRUE;
+    }
+}
+
+uint32_t ulTaskNotifyTakeIndexed(UBaseType_t index, BaseType_t clear, TickType_t wait) {
+    configASSERT(index < SHIM_NOTIFY_SLOTS);
+    uint32_t value = the_task.notify[index];
+    // Nothing else could ever give it
+    if (value == 0 && wait != 0) {
+        fprintf(stderr, "shim: notification %lu waited for, but never given\n", (unsigned long)index);
+        abort();
+    }
+    the_task.notify[index] = clear ? 0 : value - (value > 0);
+    return value;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void) {
+    return NULL;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t wait) {
+    abort();  // no semaphore can have been created
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+    abort();
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem) {
+    abort();
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void *item, BaseType_t *woken) {
+    abort();  // no queue can have been created
+}
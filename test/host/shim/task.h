@@ -0,0 +1,33 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+typedef struct shim_task *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+#define taskSCHEDULER_NOT_STARTED ((BaseType_t)1)
+#define taskSCHEDULER_RUNNING ((BaseType_t)2)
+
+#define taskENTER_CRITICAL() do {} while (0)
+#define taskEXIT_CRITICAL() do {} while (0)
+#define taskENTER_CRITICAL_FROM_ISR() ((UBaseType_t)0)
+#define taskEXIT_CRITICAL_FROM_ISR(saved) (void)(saved)
+
+/// Set by a test to send the code under test down its scheduler path
+extern BaseType_t shim_scheduler_running;
+
+BaseType_t xTaskGetSchedulerState(void);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char *name, configSTACK_DEPTH_TYPE stack, void *params,
+                       UBaseType_t priority, TaskHandle_t *created);
+void vTaskDelete(TaskHandle_t task);
+
+BaseType_t xTaskNotifyStateClearIndexed(TaskHandle_t task, UBaseType_t index);
+BaseType_t xTaskNotifyGiveIndexed(TaskHandle_t task, UBaseType_t index);
+void vTaskNotifyGiveIndexedFromISR(TaskHandle_t task, UBaseType_t index, BaseType_t *woken);
+uint32_t ulTaskNotifyTakeIndexed(UBaseType_t index, BaseType_t clear, TickType_t wait);
+
+#define xTaskNotifyGive(task) xTaskNotifyGiveIndexed((task), 0)
+#define vTaskNotifyGiveFromISR(task, woken) vTaskNotifyGiveIndexedFromISR((task), 0, (woken))
+#define ulTaskNotifyTake(clear, wait) ulTaskNotifyTakeIndexed(0, (clear), (wait))
@@ -0,0 +1,86 @@
+#pragma once
+
+/**
+ * The per-pixel drawing the ssd1306 driver used before its page-byte fast paths,
+ * kept as the reference the host tests and benchmarks compare the driver with.
+ * Everything goes through ref_plot, one bit at a time.
+ */
+
+#include "ssd1306.h"
+
+static inline void ref_plot(ssd1306_t *p, int64_t x, int64_t y, ssd1306_draw_mode_t mode) {
+    if (x < 0 || y < 0 || x >= p->width || y >= p->height) {
+        return;
+    }
+    uint8_t *b = &p->buffer[x + p->width * (y >> 3)];
+    uint8_t bit = 1 << (y & 7);
+    if (mode == SSD1306_DRAW_SET) {
+        *b |= bit;
+    } else if (mode == SSD1306_DRAW_CLEAR) {
+        *b &= ~bit;
+    } else {
+        *b ^= bit;
+    }
+}
+
+// The loops skip what is off the panel, or huge rectangles would take ages
+static inline void ref_fill_rect(ssd1306_t *p, int64_t x, int64_t y, int64_t width, int64_t height,
+                                 ssd1306_draw_mode_t mode) {
+    for (int64_t i = x < 0 ? -x : 0; i < width && x + i < p->width; i++) {
+        for (int64_t j = y < 0 ? -y : 0; j < height && y + j < p->height; j++) {
+            ref_plot(p, x + i, y + j, mode);
+        }
+    }
+}
+
+// The float slope line, one pixel per column (steep lines have gaps) and no clipping
+static inline void ref_line_float(ssd1306_t *p, int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
+    if (x1 > x2) {
+        int32_t t = x1;
+        x1 = x2;
+        x2 = t;
+        t = y1;
+        y1 = y2;
+        y2 = t;
+    }
+
+    if (x1 == x2) {
+        for (int32_t i = y1 < y2 ? y1 : y2; i <= (y1 < y2 ? y2 : y1); i++) {
+            ref_plot(p, x1, i, SSD1306_DRAW_SET);
+        }
+        return;
+    }
+
+    float m = (float)(y2 - y1) / (float)(x2 - x1);
+    for (int32_t i = x1; i <= x2; i++) {
+        float y = m * (float)(i - x1) + (float)y1;
+        ref_plot(p, i, (uint32_t)y, SSD1306_DRAW_SET);
+    }
+}
+
+// The per-pixel glyph drawing, a scale x scale square for every set bit of the font
+static inline void ref_draw_char(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const uint8_t *font, char c) {
+    if (c < font[3] || c > font[4]) {
+        return;
+    }
+
+    uint32_t parts_per_line = (font[0] >> 3) + ((font[0] & 7) > 0);
+    for (uint8_t w = 0; w < font[1]; ++w) {
+        uint32_t pp = (c - font[3]) * font[1] * parts_per_line + w * parts_per_line + 5;
+        for (uint32_t lp = 0; lp < parts_per_line; ++lp, ++pp) {
+            uint8_t line = font[pp];
+            for (int8_t j = 0; j < 8; ++j, line >>= 1) {
+                if (line & 1) {
+                    ref_fill_rect(p, x + w * scale, y + ((lp << 3) + j) * scale, scale, scale, SSD1306_DRAW_SET);
+                }
+            }
+        }
+    }
+}
+
+static inline void ref_draw_string(ssd1306_t *p, uint32_t x, uint32_t y, uint32_t scale, const uint8_t *font,
+                                   const char *s) {
+    for (uint32_t x_n = x; *s; x_n += (font[1] + font[2]) * scale) {
+        ref_draw_char(p, x_n, y, scale, font, *(s++));
+    }
+}
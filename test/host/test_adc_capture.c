@@ -0,0 +1,195 @@
+/**
+ * adc_capture decimation on the host source (adc_capture_host.h).
+ *
+ * Every output is the sum of its 4^k samples shifted right by k, rounded half
+ * up, for k = 0..6; interleaved channels stay in step however the samples
+ * arrive; a reader that falls more than half a ring behind skips to the newest
+ * samples and counts what it lost; read_latest takes the newest block; and none
+ * of it minds the sample count wrapping at 2^32.
+ */
+
+#include <stdlib.h>
+
+#include "adc_capture_host.h"
+#include "check.h"
+
+#define RING_LEN 8192  // two blocks at k = 6
+
+static uint16_t ring[RING_LEN];
+
+static uint16_t random_sample(void *user, uint32_t n) {
+    return (uint16_t)(rand() & 0x0FFF);
+}
+
+// Channel c reads 1000 * (c + 1) plus the cycle number, modulo 4096
+static uint16_t channel_ramp(void *user, uint32_t n) {
+    uint8_t channels = *(const uint8_t *)user;
+    return (uint16_t)((1000 * (n % channels + 1) + n / channels) & 0x0FFF);
+}
+
+static void test_rounding(void) {
+    for (uint8_t k = 0; k <= ADC_CAPTURE_MAX_OVERSAMPLE_BITS; k++) {
+        adc_capture_t cap;
+        adc_capture_host_t host;
+        CHECK(adc_capture_host_init(&cap, &host, ring, RING_LEN, 1, k));
+        uint32_t block = adc_capture_block_len(&cap);
+        CHECK_EQ(block, 1u << (2 * k));
+
+        srand(13 + k);
+        for (int round = 0; round < 64; round++) {
+            adc_capture_host_generate(&host, random_sample, NULL, block);
+            uint32_t sum = 0;
+            for (uint32_t i = 0; i < block; i++) {
+                sum += ring[(host.head - block + i) & (RING_LEN - 1)];
+            }
+            uint32_t out;
+            CHECK(adc_capture_read(&cap, &out));
+            CHECK_EQ(out, k == 0 ? sum : (sum + (1u << (k - 1))) >> k);
+            CHECK(out < (1u << (12 + k)));
+        }
+
+        // exact halves round up: 2000 and 2001 alternating average 2000.5
+        uint16_t dither[2] = {2000, 2001};
+        for (uint32_t i = 0; i < block; i += 2) {
+            adc_capture_host_feed(&host, dither, block == 1 ? 1 : 2);
+        }
+        uint32_t out;
+        CHECK(adc_capture_read(&cap, &out));
+        CHECK_EQ(out, k == 0 ? 2000 : (2000u << k) + (1u << (k - 1)));
+
+        // and full scale still fits
+        uint16_t top = 0x0FFF;
+        for (uint32_t i = 0; i < block; i++) {
+            adc_capture_host_feed(&host, &top, 1);
+        }
+        CHECK(adc_capture_read(&cap, &out));
+        CHECK_EQ(out, 0x0FFFu << k);
+        CHECK(!adc_capture_read(&cap, &out));
+    }
+}
+
+static void test_channels(void) {
+    uint8_t channels = 3;
+    adc_capture_t cap;
+    adc_capture_host_t host;
+    CHECK(adc_capture_host_init(&cap, &host, ring, RING_LEN, channels, 2));
+    uint32_t block = adc_capture_block_len(&cap);
+    CHECK_EQ(block, 48);
+
+    // in uneven pieces, never a whole cycle at a time
+    uint32_t outputs = 0;
+    for (uint32_t piece = 1; outputs < 40; piece = piece % 7 + 1) {
+        adc_capture_host_generate(&host, channel_ramp, &channels, piece);
+        uint32_t out[ADC_CAPTURE_MAX_CHANNELS];
+        while (adc_capture_read(&cap, out)) {
+            // the 16 cycles of output n are 16n .. 16n + 15, averaging 16n + 7.5
+            for (uint8_t c = 0; c < channels; c++) {
+                CHECK_EQ(out[c], 4 * (1000 * (c + 1) + 16 * outputs) + 30);
+            }
+            outputs++;
+        }
+    }
+    CHECK_EQ(cap.overruns, 0);
+}
+
+static void test_overruns(void) {
+    adc_capture_t cap;
+    adc_capture_host_t host;
+    CHECK(adc_capture_host_init(&cap, &host, ring, 1024, 1, 2));  // blocks of 16
+
+    // half a ring is still fine
+    adc_capture_host_generate(&host, random_sample, NULL, 512);
+    CHECK_EQ(adc_capture_available(&cap), 32);
+    CHECK_EQ(cap.overruns, 0);
+
+    // more is not: the oldest blocks are skipped, the newest half ring kept
+    adc_capture_host_generate(&host, random_sample, NULL, 16 * 10 + 5);
+    CHECK_EQ(adc_capture_available(&cap), 32);
+    CHECK_EQ(cap.overruns, 10);
+    CHECK_EQ(host.head - cap.tail, 512);
+
+    // and what is read is the newest, intact
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < 16; i++) {
+        sum += ring[(cap.tail + i) & 1023];
+    }
+    uint32_t out;
+    CHECK(adc_capture_read(&cap, &out));
+    CHECK_EQ(out, (sum + 2) >> 2);
+
+    // a whole lap behind counts every lost block
+    adc_capture_host_generate(&host, random_sample, NULL, 4096);
+    CHECK_EQ(adc_capture_available(&cap), 32);
+    CHECK_EQ(cap.overruns, 10 + (512 - 16 + 4096 - 512) / 16);
+}
+
+static void test_read_latest(void) {
+    uint8_t channels = 2;
+    adc_capture_t cap;
+    adc_capture_host_t host;
+    CHECK(adc_capture_host_init(&cap, &host, ring, RING_LEN, channels, 1));  // blocks of 8
+
+    uint32_t out[ADC_CAPTURE_MAX_CHANNELS];
+    adc_capture_host_generate(&host, channel_ramp, &channels, 7);
+    CHECK(!adc_capture_read_latest(&cap, out));
+
+    // 100 cycles and a half: the newest 4 whole cycles are 96 .. 99
+    adc_capture_host_generate(&host, channel_ramp, &channels, 200 - 7 + 1);
+    CHECK(adc_capture_read_latest(&cap, out));
+    CHECK_EQ(out[0], (4 * 1000 + 96 + 97 + 98 + 99 + 1) >> 1);
+    CHECK_EQ(out[1], (4 * 2000 + 96 + 97 + 98 + 99 + 1) >> 1);
+    CHECK_EQ(cap.overruns, 0);  // dropping older samples is what was asked for
+
+    // nothing newer yet, then only the next block counts
+    CHECK(!adc_capture_read_latest(&cap, out));
+    CHECK_EQ(adc_capture_available(&cap), 0);
+    adc_capture_host_generate(&host, channel_ramp, &channels, 8);
+    CHECK(adc_capture_read_latest(&cap, out));
+    CHECK_EQ(out[1], (4 * 2000 + 100 + 101 + 102 + 103 + 1) >> 1);  // still channel 1, in step
+}
+
+static void test_wraparound(void) {
+    uint8_t channels = 3;
+    adc_capture_t cap;
+    adc_capture_host_t host;
+    CHECK(adc_capture_host_init(&cap, &host, ring, RING_LEN, channels, 3));  // blocks of 192
+
+    // start just short of 2^32
+    host.head = 0xFFFFFFFFu - 1000;
+    adc_capture_resync(&cap);
+    uint32_t first = host.head;
+
+    for (int round = 0; round < 20; round++) {
+        adc_capture_host_generate(&host, random_sample, NULL, 3 * 64);
+        uint32_t sums[3] = {0, 0, 0};
+        for (uint32_t i = 0; i < 3 * 64; i++) {
+            sums[i % 3] += ring[(cap.tail + i) & (RING_LEN - 1)];
+        }
+        CHECK_EQ(adc_capture_available(&cap), 1);
+        uint32_t out[ADC_CAPTURE_MAX_CHANNELS];
+        CHECK(adc_capture_read(&cap, out));
+        for (uint8_t c = 0; c < 3; c++) {
+            CHECK_EQ(out[c], (sums[c] + 4) >> 3);
+        }
+    }
+    CHECK(host.head < first);  // it did wrap
+    CHECK_EQ(cap.tail, host.head);
+    CHECK_EQ(cap.overruns, 0);
+
+    // overruns across the wrap as well
+    host.head = 0xFFFFFFFFu - 100;
+    adc_capture_resync(&cap);
+    adc_capture_host_generate(&host, random_sample, NULL, RING_LEN);  // 2730 whole cycles
+    uint32_t keep = (RING_LEN / 2) / 192 * 192;
+    CHECK_EQ(adc_capture_available(&cap), keep / 192);
+    CHECK_EQ(cap.overruns, (3 * 2730 - keep) / 192);
+}
+
+int main(void) {
+    test_rounding();
+    test_channels();
+    test_overruns();
+    test_read_latest();
+    test_wraparound();
+    return CHECK_RESULT();
+}
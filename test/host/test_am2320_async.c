@@ -0,0 +1,194 @@
+/**
+ * am2320_async on its host stand-ins (am2320_async_host.h): the state machine
+ * driven through the simulated AM2320 and the host timer.
+ *
+ * A good read goes wake, wait, request, wait, read and decodes the reply; a
+ * corrupt checksum, a wrong function code and a request nobody acknowledges end
+ * the read with their error. A read while one runs is refused, the callback may
+ * start the next one. On a deferred bus every step waits for its transaction.
+ */
+
+#include "am2320.h"
+#include "am2320_async_host.h"
+#include "check.h"
+
+#define NO_SENSOR 0x5D  // < nothing answers there
+
+static am2320_result_t last;
+static int callbacks;
+
+static void on_done(void *user, const am2320_result_t *result) {
+    last = *result;
+    callbacks++;
+}
+
+static void setup(am2320_async_t *dev, am2320_async_host_timer_t *timer, i2c_bus_t *bus, i2c_bus_host_t *host,
+                  am2320_sim_t *sim, uint8_t address, bool deferred) {
+    *sim = (am2320_sim_t){.temp_raw = 0x8065, .hum_raw = 503};  // -10.1 C, 50.3 %
+    i2c_bus_host_init(bus, host, am2320_sim_device, sim, deferred);
+    am2320_async_host_init(dev, timer, bus, address);
+    callbacks = 0;
+}
+
+// Fire the waits until the read is over, on a bus that completes transactions as they start
+static void run(am2320_async_host_timer_t *timer) {
+    while (am2320_async_host_fire(timer)) {
+    }
+}
+
+static void test_good_read(void) {
+    am2320_async_t dev;
+    am2320_async_host_timer_t timer;
+    i2c_bus_t bus;
+    i2c_bus_host_t host;
+    am2320_sim_t sim;
+    setup(&dev, &timer, &bus, &host, &sim, AM2320_ADDRESS, false);
+
+    CHECK_EQ(am2320_async_read(&dev, on_done, NULL), AM2320_OK);
+    CHECK_EQ(dev.state, AM2320_WAKE_WAIT);  // the wake up call is not acknowledged, the wait starts anyway
+    CHECK_EQ(timer.delay_us, AM2320_WAKE_US);
+    CHECK(am2320_async_host_fire(&timer));
+    CHECK_EQ(dev.state, AM2320_CONVERT_WAIT);
+    CHECK_EQ(timer.delay_us, AM2320_CONVERT_US);
+    CHECK_EQ(callbacks, 0);
+    CHECK(am2320_async_host_fire(&timer));
+
+    CHECK(!am2320_async_busy(&dev));
+    CHECK(!timer.pending);
+    CHECK_EQ(callbacks, 1);
+    CHECK_EQ(last.status, AM2320_OK);
+    CHECK_EQ(last.temp, -101);
+    CHECK_EQ(last.hum, 503);
+    CHECK_EQ(timer.total_delay_us, AM2320_WAKE_US + AM2320_CONVERT_US);
+    CHECK_EQ(sim.wakes, 1);
+    CHECK_EQ(sim.replies, 1);
+}
+
+static void test_bad_replies(void) {
+    am2320_async_t dev;
+    am2320_async_host_timer_t timer;
+    i2c_bus_t bus;
+    i2c_bus_host_t host;
+    am2320_sim_t sim;
+    setup(&dev, &timer, &bus, &host, &sim, AM2320_ADDRESS, false);
+
+    sim.corrupt_crc = true;
+    CHECK_EQ(am2320_async_read(&dev, on_done, NULL), AM2320_OK);
+    run(&timer);
+    CHECK_EQ(callbacks, 1);
+    CHECK_EQ(last.status, AM2320_ERR_CRC);
+    CHECK(!am2320_async_busy(&dev));
+
+    sim.corrupt_crc = false;
+    sim.bad_frame = true;
+    CHECK_EQ(am2320_async_read(&dev, on_done, NULL), AM2320_OK);
+    run(&timer);
+    CHECK_EQ(callbacks, 2);
+    CHECK_EQ(last.status, AM2320_ERR_FRAME);
+
+    // and the next read is fine again
+    sim.bad_frame = false;
+    CHECK_EQ(am2320_async_read(&dev, on_done, NULL), AM2320_OK);
+    run(&timer);
+    CHECK_EQ(callbacks, 3);
+    CHECK_EQ(last.status, AM2320_OK);
+    CHECK_EQ(last.temp, -101);
+}
+
+static void test_no_sensor(void) {
+    am2320_async_t dev;
+    am2320_async_host_timer_t timer;
+    i2c_bus_t bus;
+    i2c_bus_host_t host;
+    am2320_sim_t sim;
+    setup(&dev, &timer, &bus, &host, &sim, NO_SENSOR, false);
+
+    // the request is not acknowledged: the read ends there, without waiting for a measurement
+    CHECK_EQ(am2320_async_read(&dev, on_done, NULL), AM2320_OK);
+    CHECK(am2320_async_host_fire(&timer));
+    CHECK(!timer.pending);
+    CHECK(!am2320_async_busy(&dev));
+    CHECK_EQ(callbacks, 1);
+    CHECK_EQ(last.status, AM2320_ERR_BUS);
+    CHECK_EQ(timer.total_delay_us, AM2320_WAKE_US);
+}
+
+static am2320_async_t *restart_dev;
+static int restarts;
+
+static void on_done_restart(void *user, const am2320_result_t *result) {
+    on_done(user, result);
+    if (restarts-- > 0) {
+        CHECK_EQ(am2320_async_read(restart_dev, on_done_restart, NULL), AM2320_OK);
+    }
+}
+
+static void test_busy(void) {
+    am2320_async_t dev;
+    am2320_async_host_timer_t timer;
+    i2c_bus_t bus;
+    i2c_bus_host_t host;
+    am2320_sim_t sim;
+    setup(&dev, &timer, &bus, &host, &sim, AM2320_ADDRESS, false);
+
+    CHECK_EQ(am2320_async_read(&dev, on_done, NULL), AM2320_OK);
+    CHECK_EQ(am2320_async_read(&dev, on_done, NULL), AM2320_ERR_BUSY);
+    CHECK(am2320_async_host_fire(&timer));
+    CHECK_EQ(am2320_async_read(&dev, on_done, NULL), AM2320_ERR_BUSY);
+    run(&timer);
+    CHECK_EQ(callbacks, 1);
+    CHECK_EQ(last.status, AM2320_OK);  // the refused reads did not disturb the running one
+
+    // the driver is idle by the time the callback runs, it can start the next read
+    restart_dev = &dev;
+    restarts = 2;
+    callbacks = 0;
+    CHECK_EQ(am2320_async_read(&dev, on_done_restart, NULL), AM2320_OK);
+    run(&timer);
+    CHECK_EQ(callbacks, 3);
+    CHECK_EQ(sim.replies, 4);
+    CHECK(!am2320_async_busy(&dev));
+}
+
+static void test_deferred_bus(void) {
+    am2320_async_t dev;
+    am2320_async_host_timer_t timer;
+    i2c_bus_t bus;
+    i2c_bus_host_t host;
+    am2320_sim_t sim;
+    setup(&dev, &timer, &bus, &host, &sim, AM2320_ADDRESS, true);
+
+    // every step waits for its transaction to complete, and no timer runs meanwhile
+    CHECK_EQ(am2320_async_read(&dev, on_done, NULL), AM2320_OK);
+    CHECK_EQ(dev.state, AM2320_WAKING);
+    CHECK(!timer.pending);
+    CHECK(i2c_bus_host_service(&host));
+    CHECK_EQ(dev.state, AM2320_WAKE_WAIT);
+
+    CHECK(am2320_async_host_fire(&timer));
+    CHECK_EQ(dev.state, AM2320_REQUESTING);
+    CHECK(!timer.pending);
+    CHECK(i2c_bus_host_service(&host));
+    CHECK_EQ(dev.state, AM2320_CONVERT_WAIT);
+
+    CHECK(am2320_async_host_fire(&timer));
+    CHECK_EQ(dev.state, AM2320_READING);
+    CHECK_EQ(callbacks, 0);
+    CHECK_EQ(am2320_async_read(&dev, on_done, NULL), AM2320_ERR_BUSY);
+    CHECK(i2c_bus_host_service(&host));
+
+    CHECK(!i2c_bus_host_service(&host));
+    CHECK(!am2320_async_busy(&dev));
+    CHECK_EQ(callbacks, 1);
+    CHECK_EQ(last.status, AM2320_OK);
+    CHECK_EQ(last.hum, 503);
+}
+
+int main(void) {
+    test_good_read();
+    test_bad_replies();
+    test_no_sensor();
+    test_busy();
+    test_deferred_bus();
+    return CHECK_RESULT();
+}
@@ -0,0 +1,211 @@
+/**
+ * am2320_mux on its host stand-ins (am2320_mux_host.h): a TCA9548A with simulated
+ * AM2320s on a simulated clock, which refuse requests and reads sent at the wrong
+ * time.
+ *
+ * Ordering: every sensor goes wake, request, read, each with its own channel
+ * selected, the channel select is only written when the channel changes, no more
+ * than AM2320_MUX_WAKE_AHEAD sensors are woken and not asked at a time, and no
+ * sensor sees a timing error. Throughput: a pipelined read of N sensors takes one
+ * sensor's waits plus the bus time of N, well under N single reads. Faults stay
+ * with their channel. A timer that refuses every alarm asked for under the lock
+ * gets asked again once it is released, and the read takes just as long.
+ */
+
+#include <string.h>
+
+#include "am2320.h"
+#include "am2320_mux_host.h"
+#include "check.h"
+
+#define BUS_HZ 100000
+
+static am2320_result_t results[AM2320_MUX_CHANNELS];
+static int callbacks;
+
+static void on_done(void *user, const am2320_result_t *r) {
+    memcpy(results, r, sizeof(results));
+    callbacks++;
+}
+
+static void setup(am2320_mux_host_t *host, am2320_mux_t *mux, i2c_bus_t *bus, uint8_t channels) {
+    am2320_mux_host_init(host, mux, bus, channels, BUS_HZ);
+    for (uint8_t c = 0; c < AM2320_MUX_CHANNELS; c++) {
+        host->sensors[c].temp_raw = 200 + c;  // 20.0 C and up
+        host->sensors[c].hum_raw = 400 + 10 * c;
+    }
+    callbacks = 0;
+}
+
+static uint64_t read_all(am2320_mux_host_t *host, am2320_mux_t *mux) {
+    CHECK_EQ(am2320_mux_read(mux, on_done, NULL), AM2320_OK);
+    uint64_t took = am2320_mux_host_run(host);
+    CHECK(!am2320_mux_busy(mux));
+    CHECK_EQ(callbacks, 1);
+    callbacks = 0;
+    return took;
+}
+
+static int channel_of(uint8_t selected) {
+    return selected != 0 && (selected & (selected - 1)) == 0 ? __builtin_ctz(selected) : -1;
+}
+
+static void test_ordering(void) {
+    i2c_bus_t bus;
+    am2320_mux_t mux;
+    am2320_mux_host_t host;
+    const uint8_t channels = 0x2D;  // 0, 2, 3 and 5
+    setup(&host, &mux, &bus, channels);
+    read_all(&host, &mux);
+
+    // each sensor's steps, in order: 0 none, 1 woken, 2 asked, 3 read
+    uint8_t step[AM2320_MUX_CHANNELS] = {0};
+    uint8_t last_select = 0;
+    int woken_not_asked = 0, most_woken = 0, selects = 0, switches = 0, last_channel = -1;
+    CHECK(host.log_len <= AM2320_MUX_HOST_LOG);
+
+    for (uint32_t i = 0; i < host.log_len; i++) {
+        const am2320_mux_host_event_t *e = &host.log[i];
+        if (e->addr == TCA9548A_ADDRESS) {
+            CHECK(e->tx_len == 1 && e->rx_len == 0);
+            CHECK(e->tx0 != last_select);  // only written when it changes
+            last_select = e->tx0;
+            selects++;
+            continue;
+        }
+
+        CHECK_EQ(e->addr, AM2320_ADDRESS);
+        int c = channel_of(e->selected);
+        CHECK(c >= 0 && (channels & (1u << c)) != 0);  // one channel, and one of ours
+        if (c < 0) {
+            continue;
+        }
+        if (c != last_channel) {
+            switches++;
+            last_channel = c;
+        }
+
+        if (e->tx_len == 1 && e->tx0 == 0x00) {
+            CHECK_EQ(step[c], 0);
+            step[c] = 1;
+            woken_not_asked++;
+            most_woken = woken_not_asked > most_woken ? woken_not_asked : most_woken;
+        } else if (e->tx_len == 3 && e->tx0 == AM2320_CMD_READREG) {
+            CHECK_EQ(step[c], 1);
+            CHECK_EQ(e->result, 3);
+            step[c] = 2;
+            woken_not_asked--;
+        } else {
+            CHECK(e->tx_len == 0 && e->rx_len == 8);
+            CHECK_EQ(step[c], 2);
+            CHECK_EQ(e->result, 8);
+            step[c] = 3;
+        }
+    }
+
+    CHECK_EQ(selects, switches);
+    CHECK(most_woken <= AM2320_MUX_WAKE_AHEAD);
+    CHECK(most_woken > 1);  // the waits did overlap
+    for (uint8_t c = 0; c < AM2320_MUX_CHANNELS; c++) {
+        bool used = (channels & (1u << c)) != 0;
+        CHECK_EQ(step[c], used ? 3 : 0);
+        CHECK_EQ(host.sensors[c].timing_errors, 0);
+        CHECK_EQ(host.sensors[c].wakes, used ? 1 : 0);
+        CHECK_EQ(host.sensors[c].replies, used ? 1 : 0);
+        if (used) {
+            CHECK_EQ(results[c].status, AM2320_OK);
+            CHECK_EQ(results[c].temp, 200 + c);
+            CHECK_EQ(results[c].hum, 400 + 10 * c);
+        }
+    }
+}
+
+static void test_throughput(void) {
+    i2c_bus_t bus;
+    am2320_mux_t mux;
+    am2320_mux_host_t host;
+    uint64_t single = 0;
+
+    printf("am2320_mux read at %u Hz, simulated time\n", BUS_HZ);
+    for (uint8_t n = 1; n <= AM2320_MUX_CHANNELS; n++) {
+        uint8_t channels = (uint8_t)((1u << n) - 1);
+        setup(&host, &mux, &bus, channels);
+        uint64_t took = read_all(&host, &mux);
+        uint64_t again = read_all(&host, &mux);  // the mux channel is no longer known, same work
+        if (n == 1) {
+            single = took;
+        }
+        printf("  %u sensors %6llu us, %5.2f single reads\n", n, (unsigned long long)took, (double)took / single);
+
+        int errors = 0;
+        for (uint8_t c = 0; c < n; c++) {
+            errors += host.sensors[c].timing_errors + (results[c].status != AM2320_OK);
+        }
+        CHECK_EQ(errors, 0);
+        CHECK_EQ(again, took);
+
+        // the waits overlap: the conversions cost once, every sensor adds only its bus time and a part of the wake
+        CHECK(took >= single);
+        CHECK(took <= single + (uint64_t)(n - 1) * (single - AM2320_CONVERT_US));
+        if (n >= 5) {
+            CHECK(took * 2 <= single * n);  // from here on the bus, not the waits, sets the pace
+        }
+    }
+}
+
+static void test_faults(void) {
+    i2c_bus_t bus;
+    am2320_mux_t mux;
+    am2320_mux_host_t host;
+    setup(&host, &mux, &bus, 0x0F);
+    host.populated = 0x0D;             // nothing on channel 1
+    host.sensors[2].corrupt_crc = true;
+    host.sensors[3].bad_frame = true;
+
+    CHECK_EQ(am2320_mux_read(&mux, on_done, NULL), AM2320_OK);
+    CHECK_EQ(am2320_mux_read(&mux, on_done, NULL), AM2320_ERR_BUSY);
+    am2320_mux_host_run(&host);
+    CHECK_EQ(callbacks, 1);
+    CHECK_EQ(results[0].status, AM2320_OK);
+    CHECK_EQ(results[1].status, AM2320_ERR_BUS);
+    CHECK_EQ(results[2].status, AM2320_ERR_CRC);
+    CHECK_EQ(results[3].status, AM2320_ERR_FRAME);
+    CHECK_EQ(host.sensors[0].timing_errors, 0);
+
+    // the next read is clean once the faults are gone
+    callbacks = 0;
+    host.populated = 0x0F;
+    host.sensors[2].corrupt_crc = false;
+    host.sensors[3].bad_frame = false;
+    host.now_us += AM2320_MIN_INTERVAL_MS * 1000;
+    read_all(&host, &mux);
+    for (uint8_t c = 0; c < 4; c++) {
+        CHECK_EQ(results[c].status, AM2320_OK);
+        CHECK_EQ(results[c].temp, 200 + c);
+    }
+}
+
+static void test_refused_alarms(void) {
+    i2c_bus_t bus;
+    am2320_mux_t mux;
+    am2320_mux_host_t host;
+    setup(&host, &mux, &bus, 0x0F);
+    uint64_t took = read_all(&host, &mux);
+
+    setup(&host, &mux, &bus, 0x0F);
+    host.refuse_locked = true;
+    CHECK_EQ(read_all(&host, &mux), took);
+    CHECK(host.refused > 0);
+    for (uint8_t c = 0; c < 4; c++) {
+        CHECK_EQ(results[c].status, AM2320_OK);
+        CHECK_EQ(host.sensors[c].timing_errors, 0);
+    }
+}
+
+int main(void) {
+    test_ordering();
+    test_throughput();
+    test_faults();
+    test_refused_alarms();
+    return CHECK_RESULT();
+}
@@ -0,0 +1,70 @@
+/**
+ * CRC16/Modbus (crc16.h), both the 256 and the 16 entry table (crc16_both.h):
+ * the catalogue check value 0x4B37 for "123456789", a reply frame from the AM2320
+ * datasheet, and the bit by bit definition over random buffers, split at random
+ * points through crc16_modbus_update.
+ */
+
+#include <stdlib.h>
+
+#include "check.h"
+#include "crc16_both.h"
+
+// The definition, one bit at a time
+static uint16_t crc16_bitwise(const uint8_t *buf, size_t len) {
+    uint16_t crc = CRC16_MODBUS_INIT;
+    while (len--) {
+        crc ^= *buf++;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = crc & 1 ? (crc >> 1) ^ 0xA001 : crc >> 1;
+        }
+    }
+    return crc;
+}
+
+static void test_check_value(void) {
+    const uint8_t check[] = "123456789";
+    CHECK_EQ(crc16_byte(check, 9), 0x4B37);
+    CHECK_EQ(crc16_nibble(check, 9), 0x4B37);
+    CHECK_EQ(crc16_byte(check, 0), CRC16_MODBUS_INIT);
+    CHECK_EQ(crc16_nibble(check, 0), CRC16_MODBUS_INIT);
+}
+
+static void test_am2320_frame(void) {
+    // read 4 registers from 0x00: 50.0 %RH, 25.0 C, then the CRC low byte first
+    const uint8_t reply[8] = {0x03, 0x04, 0x01, 0xF4, 0x00, 0xFA, 0x31, 0xA5};
+    uint16_t sent = (reply[7] << 8) | reply[6];
+    CHECK_EQ(crc16_byte(reply, 6), sent);
+    CHECK_EQ(crc16_nibble(reply, 6), sent);
+
+    // the whole frame, CRC included, leaves 0 behind
+    CHECK_EQ(crc16_byte(reply, 8), 0);
+    CHECK_EQ(crc16_nibble(reply, 8), 0);
+}
+
+static void test_random_buffers(void) {
+    uint8_t buf[300];
+    srand(16);
+    for (int i = 0; i < 20000; i++) {
+        size_t len = rand() % sizeof(buf);
+        for (size_t k = 0; k < len; k++) {
+            buf[k] = (uint8_t)rand();
+        }
+        uint16_t expected = crc16_bitwise(buf, len);
+        CHECK_EQ(crc16_byte(buf, len), expected);
+        CHECK_EQ(crc16_nibble(buf, len), expected);
+
+        size_t split = len ? rand() % len : 0;
+        CHECK_EQ(crc16_byte_update(crc16_byte_update(CRC16_MODBUS_INIT, buf, split), buf + split, len - split),
+                 expected);
+        CHECK_EQ(crc16_nibble_update(crc16_nibble_update(CRC16_MODBUS_INIT, buf, split), buf + split, len - split),
+                 expected);
+    }
+}
+
+int main(void) {
+    test_check_value();
+    test_am2320_frame();
+    test_random_buffers();
+    return CHECK_RESULT();
+}
@@ -0,0 +1,196 @@
+/**
+ * i2c_bus queueing and completion on the host transport: transactions run in
+ * submission order, a nostop transaction makes the next one start with a repeated
+ * start, and failed transactions complete with their error without stalling the
+ * queue.
+ */
+
+#include <pico/stdlib.h>
+
+#include "check.h"
+#include "i2c_bus_host.h"
+
+#define BAD_ADDR 0x77  // < the emulated device does not acknowledge this one
+
+typedef struct {
+    uint8_t addr;
+    bool restart;
+    bool nostop;
+    size_t tx_len;
+    size_t rx_len;
+} call_t;
+
+typedef struct {
+    i2c_bus_host_t *host;
+    call_t calls[16];
+    int count;
+} device_t;
+
+static int device(void *user, i2c_bus_xfer_t *xfer) {
+    device_t *d = user;
+    d->calls[d->count++] = (call_t){xfer->addr, d->host->restart, xfer->nostop, xfer->tx_len, xfer->rx_len};
+    if (xfer->addr == BAD_ADDR) {
+        return PICO_ERROR_GENERIC;
+    }
+    for (size_t i = 0; i < xfer->rx_len; i++) {
+        xfer->rx[i] = (uint8_t)(xfer->addr + i);
+    }
+    return (int)(xfer->tx_len + xfer->rx_len);
+}
+
+static i2c_bus_xfer_t *finished[16];
+static int finished_count;
+
+static void on_done(i2c_bus_xfer_t *xfer) {
+    finished[finished_count++] = xfer;
+}
+
+static void test_submit_order(void) {
+    i2c_bus_t bus;
+    i2c_bus_host_t host;
+    device_t d = {.host = &host};
+    i2c_bus_host_init(&bus, &host, device, &d, true);
+    finished_count = 0;
+
+    const uint8_t cmd[] = {1, 2, 3};
+    uint8_t rx[4];
+    i2c_bus_xfer_t a = {.addr = 0x10, .tx = cmd, .tx_len = 3, .done = on_done};
+    i2c_bus_xfer_t b = {.addr = 0x20, .rx = rx, .rx_len = 4, .done = on_done};
+    i2c_bus_xfer_t c = {.addr = 0x30, .tx = cmd, .tx_len = 1, .rx = rx, .rx_len = 2, .done = on_done};
+    i2c_bus_xfer_t empty = {.addr = 0x40, .done = on_done};
+
+    CHECK(i2c_bus_submit(&bus, &a));
+    CHECK(i2c_bus_submit(&bus, &b));
+    CHECK(i2c_bus_submit(&bus, &c));
+    CHECK(!i2c_bus_submit(&bus, &empty));
+
+    // Only the first one is on the wire, the others wait behind it
+    CHECK(host.pending == &a);
+    CHECK(bus.current == &a);
+    CHECK_EQ(d.count, 0);
+
+    // Each completion starts the next transaction straight away
+    CHECK(i2c_bus_host_service(&host));
+    CHECK(host.pending == &b);
+    CHECK(i2c_bus_host_service(&host));
+    CHECK(i2c_bus_host_service(&host));
+    CHECK(!i2c_bus_host_service(&host));
+    CHECK(bus.current == NULL);
+
+    CHECK_EQ(d.count, 3);
+    CHECK_EQ(d.calls[0].addr, 0x10);
+    CHECK_EQ(d.calls[1].addr, 0x20);
+    CHECK_EQ(d.calls[2].addr, 0x30);
+    CHECK_EQ(finished_count, 3);
+    CHECK(finished[0] == &a && finished[1] == &b && finished[2] == &c);
+    CHECK_EQ(a.result, 3);
+    CHECK_EQ(b.result, 4);
+    CHECK_EQ(c.result, 3);
+    CHECK_EQ(rx[0], 0x30);
+    CHECK_EQ(rx[1], 0x31);
+
+    i2c_bus_stats_t stats;
+    i2c_bus_get_stats(&bus, &stats);
+    CHECK_EQ(stats.xfers, 3);
+    CHECK_EQ(stats.errors, 0);
+    CHECK_EQ(stats.bytes, 10);
+}
+
+static i2c_bus_xfer_t chained = {.addr = 0x50, .tx_len = 0, .rx_len = 1};
+static uint8_t chained_rx;
+
+static void submit_chained(i2c_bus_xfer_t *xfer) {
+    on_done(xfer);
+    chained.rx = &chained_rx;
+    chained.done = on_done;
+    i2c_bus_submit(xfer->user, &chained);
+}
+
+static void test_submit_from_callback(void) {
+    i2c_bus_t bus;
+    i2c_bus_host_t host;
+    device_t d = {.host = &host};
+    i2c_bus_host_init(&bus, &host, device, &d, true);
+    finished_count = 0;
+
+    const uint8_t cmd = 0xAA;
+    i2c_bus_xfer_t a = {.addr = 0x10, .tx = &cmd, .tx_len = 1, .done = submit_chained, .user = &bus};
+    i2c_bus_xfer_t b = {.addr = 0x20, .tx = &cmd, .tx_len = 1, .done = on_done};
+    i2c_bus_submit(&bus, &a);
+    i2c_bus_submit(&bus, &b);
+
+    // Submitted from a's callback, after b which was already queued
+    while (i2c_bus_host_service(&host)) {
+    }
+    CHECK_EQ(finished_count, 3);
+    CHECK(finished[0] == &a && finished[1] == &b && finished[2] == &chained);
+    CHECK_EQ(chained.result, 1);
+    CHECK_EQ(chained_rx, 0x50);
+}
+
+static void test_nostop_restart(bool scheduler_running) {
+    i2c_bus_t bus;
+    i2c_bus_host_t host;
+    device_t d = {.host = &host};
+    i2c_bus_host_init(&bus, &host, device, &d, false);
+    shim_scheduler_running = scheduler_running;
+
+    const uint8_t reg = 0x03;
+    uint8_t rx[2];
+    CHECK_EQ(i2c_bus_write(&bus, 0x5C, &reg, 1, true), 1);
+    CHECK_EQ(i2c_bus_read(&bus, 0x5C, rx, 2, false), 2);
+    CHECK_EQ(i2c_bus_write(&bus, 0x5C, &reg, 1, false), 1);
+
+    CHECK_EQ(d.count, 3);
+    CHECK(!d.calls[0].restart && d.calls[0].nostop);
+    CHECK(d.calls[1].restart && !d.calls[1].nostop);  // kept the bus after the register write
+    CHECK(!d.calls[2].restart);
+    CHECK_EQ(rx[1], 0x5D);
+
+    shim_scheduler_running = pdFALSE;
+}
+
+static void test_error_completion(void) {
+    i2c_bus_t bus;
+    i2c_bus_host_t host;
+    device_t d = {.host = &host};
+    i2c_bus_host_init(&bus, &host, device, &d, true);
+    finished_count = 0;
+
+    const uint8_t cmd = 0x01;
+    i2c_bus_xfer_t bad = {.addr = BAD_ADDR, .tx = &cmd, .tx_len = 1, .nostop = true, .done = on_done};
+    i2c_bus_xfer_t good = {.addr = 0x10, .tx = &cmd, .tx_len = 1, .done = on_done};
+    i2c_bus_submit(&bus, &bad);
+    i2c_bus_submit(&bus, &good);
+    while (i2c_bus_host_service(&host)) {
+    }
+
+    // The failure is reported and does not hold up what was queued behind it
+    CHECK_EQ(finished_count, 2);
+    CHECK_EQ(bad.result, PICO_ERROR_GENERIC);
+    CHECK_EQ(good.result, 1);
+    CHECK(!d.calls[1].restart);  // a failed nostop transaction does not keep the bus
+
+    i2c_bus_stats_t stats;
+    i2c_bus_get_stats(&bus, &stats);
+    CHECK_EQ(stats.xfers, 2);
+    CHECK_EQ(stats.errors, 1);
+    CHECK_EQ(stats.bytes, 1);
+
+    // The same from a task waiting on the result
+    host.deferred = false;
+    shim_scheduler_running = pdTRUE;
+    CHECK_EQ(i2c_bus_write(&bus, BAD_ADDR, &cmd, 1, false), PICO_ERROR_GENERIC);
+    CHECK_EQ(i2c_bus_write(&bus, 0x10, &cmd, 0, false), PICO_ERROR_GENERIC);  // empty, never started
+    shim_scheduler_running = pdFALSE;
+    CHECK_EQ(d.count, 3);
+}
+
+int main(void) {
+    test_submit_order();
+    test_submit_from_callback();
+    test_nostop_restart(false);
+    test_nostop_restart(true);
+    test_error_completion();
+    return CHECK_RESULT();
+}
@@ -0,0 +1,355 @@
+/**
+ * The streaming sensor filters (sensor_filter.h).
+ *
+ * The moving average and median are compared sample by sample with the obvious
+ * implementations (sum / sort the last len samples) over noisy input, duplicates
+ * and extreme values included. The EMA has to start at its first sample, follow
+ * the float recurrence within a count and settle exactly on a steady input from
+ * either side. Outlier rejection drops spikes, gives in to a real step after
+ * max_rejects in a row, and an accepted sample starts the count again. Decimation
+ * emits the rounded mean of each block. Chains run their stages in order, stop at
+ * the first stage that swallows a sample and reset all of them.
+ */
+
+#include <limits.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "check.h"
+#include "sensor_filter.h"
+
+static int32_t noisy(int32_t base, int32_t spread) {
+    return base + rand() % (2 * spread + 1) - spread;
+}
+
+static int compare(const void *a, const void *b) {
+    int32_t x = *(const int32_t *)a, y = *(const int32_t *)b;
+    return (x > y) - (x < y);
+}
+
+// The rounded mean of the filter (halves away from zero) from a plain sum
+static int32_t rounded_mean(const int32_t *samples, int count) {
+    int64_t sum = 0;
+    for (int i = 0; i < count; i++) {
+        sum += samples[i];
+    }
+    return (int32_t)(sum >= 0 ? (sum + count / 2) / count : (sum - count / 2) / count);
+}
+
+static int32_t input(int i) {
+    switch (i % 97) {
+    case 13:
+        return INT32_MAX;
+    case 14:
+        return INT32_MIN;
+    case 40:
+    case 41:
+    case 42:
+        return 7;  // duplicates
+    default:
+        return noisy(i % 200 < 100 ? 1000 : -1000, 300);
+    }
+}
+
+static void test_mavg(void) {
+    static int32_t history[2000];
+    sensor_filter_mavg_t f;
+
+    CHECK(sensor_filter_mavg_init(&f, 0) == NULL);
+    CHECK(sensor_filter_mavg_init(&f, SENSOR_FILTER_MAVG_MAX + 1) == NULL);
+
+    for (uint16_t len = 1; len <= SENSOR_FILTER_MAVG_MAX; len += len < 8 ? 1 : 7) {
+        CHECK(sensor_filter_mavg_init(&f, len) == &f.stage);
+        srand(len);
+        int failures = 0;
+        for (int i = 0; i < 2000; i++) {
+            int32_t out = 0;
+            history[i] = input(i);
+            CHECK(sensor_filter_run(&f.stage, history[i], &out));
+            int count = i + 1 < len ? i + 1 : len;
+            if (out != rounded_mean(&history[i + 1 - count], count) && failures++ < 3) {
+                fprintf(stderr, "mavg %u, sample %d: %ld, expected %ld\n", len, i, (long)out,
+                        (long)rounded_mean(&history[i + 1 - count], count));
+            }
+        }
+        CHECK_EQ(failures, 0);
+    }
+}
+
+static void test_median(void) {
+    static int32_t history[2000];
+    int32_t sorted[SENSOR_FILTER_MEDIAN_MAX];
+    sensor_filter_median_t f;
+
+    CHECK(sensor_filter_median_init(&f, 0) == NULL);
+    CHECK(sensor_filter_median_init(&f, SENSOR_FILTER_MEDIAN_MAX + 1) == NULL);
+
+    for (uint8_t len = 1; len <= SENSOR_FILTER_MEDIAN_MAX; len++) {
+        CHECK(sensor_filter_median_init(&f, len) == &f.stage);
+        srand(100 + len);
+        int failures = 0;
+        for (int i = 0; i < 2000; i++) {
+            int32_t out = 0;
+            history[i] = i % 5 == 0 ? noisy(0, 3) : input(i);  // repeats within the window
+            CHECK(sensor_filter_run(&f.stage, history[i], &out));
+            int count = i + 1 < len ? i + 1 : len;
+            memcpy(sorted, &history[i + 1 - count], count * sizeof(int32_t));
+            qsort(sorted, count, sizeof(int32_t), compare);
+            if (out != sorted[count / 2] && failures++ < 3) {
+                fprintf(stderr, "median %u, sample %d: %ld, expected %ld\n", len, i, (long)out,
+                        (long)sorted[count / 2]);
+            }
+        }
+        CHECK_EQ(failures, 0);
+    }
+
+    // a single spike never gets through a window of 3
+    CHECK(sensor_filter_median_init(&f, 3) == &f.stage);
+    const int32_t spiky[] = {10, 10, 500, 10, 11, -400, 11, 12};
+    for (size_t i = 0; i < sizeof(spiky) / sizeof(spiky[0]); i++) {
+        int32_t out = 0;
+        sensor_filter_run(&f.stage, spiky[i], &out);
+        CHECK(out >= 10 && out <= 12);
+    }
+}
+
+static void test_ema(void) {
+    sensor_filter_ema_t f;
+    int32_t out = 0;
+
+    CHECK(sensor_filter_ema_init(&f, 17) == NULL);
+
+    for (uint8_t shift = 0; shift <= 16; shift++) {
+        CHECK(sensor_filter_ema_init(&f, shift) == &f.stage);
+
+        // starts at the first sample instead of ramping up from 0
+        CHECK(sensor_filter_run(&f.stage, 5000, &out));
+        CHECK_EQ(out, 5000);
+
+        // follows y += (x - y) / 2^shift, and ends up exactly on a steady input from below and above
+        const int32_t targets[] = {5001, 8000, 7999, -123456, -123455, 0, 1, -1};
+        double y = 5000;
+        for (size_t t = 0; t < sizeof(targets) / sizeof(targets[0]); t++) {
+            int steps = 40 << shift;
+            double worst = 0;
+            for (int i = 0; i < steps; i++) {
+                CHECK(sensor_filter_run(&f.stage, targets[t], &out));
+                y += (targets[t] - y) / (double)(1 << shift);
+                worst = fmax(worst, fabs(out - y));
+            }
+            if (worst > 1.0) {
+                fprintf(stderr, "ema shift %u towards %ld: %.2f off the float recurrence\n", shift,
+                        (long)targets[t], worst);
+                CHECK(false);
+            }
+            if (out != targets[t]) {
+                fprintf(stderr, "ema shift %u settled on %ld, the input is %ld\n", shift, (long)out,
+                        (long)targets[t]);
+                CHECK(false);
+            }
+            y = targets[t];
+        }
+
+        // no overflow at the ends of the range
+        sensor_filter_reset(&f.stage);
+        CHECK(sensor_filter_run(&f.stage, INT32_MAX, &out));
+        CHECK(sensor_filter_run(&f.stage, INT32_MIN, &out));
+        y = INT32_MAX + ((double)INT32_MIN - INT32_MAX) / (double)(1 << shift);
+        CHECK(fabs(out - y) <= 1.0);
+
+        // a reset starts again at the next sample
+        sensor_filter_reset(&f.stage);
+        CHECK(sensor_filter_run(&f.stage, -77, &out));
+        CHECK_EQ(out, -77);
+    }
+}
+
+static bool outlier_feed(sensor_filter_outlier_t *f, int32_t in, int32_t *out) {
+    return sensor_filter_run(&f->stage, in, out);
+}
+
+static void test_outlier(void) {
+    sensor_filter_outlier_t f;
+    int32_t out = 0;
+
+    CHECK(sensor_filter_outlier_init(&f, -1, 3) == NULL);
+    CHECK(sensor_filter_outlier_init(&f, 50, 3) == &f.stage);
+
+    // the first sample is always accepted, steps up to the threshold too
+    CHECK(outlier_feed(&f, 1000, &out));
+    CHECK_EQ(out, 1000);
+    CHECK(outlier_feed(&f, 1050, &out));
+    CHECK(outlier_feed(&f, 1000, &out));
+    CHECK_EQ(f.rejected, 0);
+
+    // spikes are dropped and do not move the reference
+    CHECK(!outlier_feed(&f, 1051, &out));
+    CHECK(!outlier_feed(&f, 949, &out));
+    CHECK(outlier_feed(&f, 1020, &out));
+    CHECK_EQ(out, 1020);
+    CHECK_EQ(f.rejected, 2);
+
+    // an accepted sample starts the count again: two more rejections are allowed
+    CHECK(!outlier_feed(&f, 5000, &out));
+    CHECK(!outlier_feed(&f, 5000, &out));
+    CHECK_EQ(f.rejects, 2);
+    CHECK(outlier_feed(&f, 1010, &out));
+    CHECK_EQ(f.rejects, 0);
+    CHECK(!outlier_feed(&f, 5000, &out));
+    CHECK(!outlier_feed(&f, 5000, &out));
+    CHECK(!outlier_feed(&f, 5000, &out));
+
+    // a real step gets through once max_rejects is used up, and becomes the reference
+    CHECK(outlier_feed(&f, 5000, &out));
+    CHECK_EQ(out, 5000);
+    CHECK_EQ(f.rejects, 0);
+    CHECK(outlier_feed(&f, 5010, &out));
+    CHECK(!outlier_feed(&f, 1010, &out));
+    CHECK_EQ(f.rejected, 8);
+
+    // the whole int32 range without overflowing the step
+    CHECK(outlier_feed(&f, 5000, &out));
+    sensor_filter_reset(&f.stage);
+    CHECK(outlier_feed(&f, INT32_MAX, &out));
+    CHECK(!outlier_feed(&f, INT32_MIN, &out));
+
+    // a reset forgets the reference, not the total
+    sensor_filter_reset(&f.stage);
+    CHECK(outlier_feed(&f, -300, &out));
+    CHECK_EQ(out, -300);
+    CHECK_EQ(f.rejected, 9);
+
+    // max_rejects 0 never rejects, threshold 0 only takes repeats
+    CHECK(sensor_filter_outlier_init(&f, 0, 0) == &f.stage);
+    CHECK(outlier_feed(&f, 1, &out));
+    CHECK(outlier_feed(&f, 100000, &out));
+    CHECK(sensor_filter_outlier_init(&f, 0, 1) == &f.stage);
+    CHECK(outlier_feed(&f, 1, &out));
+    CHECK(outlier_feed(&f, 1, &out));
+    CHECK(!outlier_feed(&f, 2, &out));
+    CHECK(outlier_feed(&f, 2, &out));
+}
+
+static void test_decimate(void) {
+    static int32_t history[1200];
+    sensor_filter_decimate_t f;
+
+    CHECK(sensor_filter_decimate_init(&f, 0) == NULL);
+
+    const uint16_t factors[] = {1, 2, 3, 4, 7, 16, 100};
+    for (size_t k = 0; k < sizeof(factors) / sizeof(factors[0]); k++) {
+        uint16_t factor = factors[k];
+        CHECK(sensor_filter_decimate_init(&f, factor) == &f.stage);
+        srand(factor);
+        int emitted = 0, failures = 0;
+        for (int i = 0; i < 1200; i++) {
+            int32_t out = 0;
+            history[i] = input(i);
+            bool got = sensor_filter_run(&f.stage, history[i], &out);
+            CHECK_EQ(got, (i + 1) % factor == 0);
+            if (got) {
+                emitted++;
+                if (out != rounded_mean(&history[i + 1 - factor], factor) && failures++ < 3) {
+                    fprintf(stderr, "decimate %u, sample %d: %ld, expected %ld\n", factor, i, (long)out,
+                            (long)rounded_mean(&history[i + 1 - factor], factor));
+                }
+            }
+        }
+        CHECK_EQ(emitted, 1200 / factor);
+        CHECK_EQ(failures, 0);
+    }
+
+    // halves round away from zero
+    int32_t out = 0;
+    sensor_filter_decimate_init(&f, 2);
+    sensor_filter_run(&f.stage, 1, &out);
+    CHECK(sensor_filter_run(&f.stage, 2, &out));
+    CHECK_EQ(out, 2);
+    sensor_filter_run(&f.stage, -1, &out);
+    CHECK(sensor_filter_run(&f.stage, -2, &out));
+    CHECK_EQ(out, -2);
+
+    // a reset drops a partial block
+    sensor_filter_decimate_init(&f, 3);
+    sensor_filter_run(&f.stage, 900, &out);
+    sensor_filter_reset(&f.stage);
+    CHECK(!sensor_filter_run(&f.stage, 3, &out));
+    CHECK(!sensor_filter_run(&f.stage, 3, &out));
+    CHECK(sensor_filter_run(&f.stage, 3, &out));
+    CHECK_EQ(out, 3);
+}
+
+static void test_chain(void) {
+    sensor_filter_outlier_t outlier;
+    sensor_filter_median_t median;
+    sensor_filter_ema_t ema;
+    sensor_filter_decimate_t decimate;
+    sensor_filter_median_t median_alone;
+    sensor_filter_ema_t ema_alone;
+    sensor_filter_decimate_t decimate_alone;
+    int32_t out = 0;
+
+    // a failed init fails the chain, an empty chain passes samples through
+    sensor_filter_stage_t *bad[] = {sensor_filter_median_init(&median, 3), sensor_filter_ema_init(&ema, 99)};
+    CHECK(sensor_filter_chain(bad, 2) == NULL);
+    CHECK(sensor_filter_chain(bad, 0) == NULL);
+    CHECK(sensor_filter_run(NULL, 42, &out));
+    CHECK_EQ(out, 42);
+
+    // the firmware's temperature chain plus a decimator, against the stages run one by one
+    sensor_filter_stage_t *stages[] = {
+        sensor_filter_outlier_init(&outlier, 200, 3),
+        sensor_filter_median_init(&median, 5),
+        sensor_filter_ema_init(&ema, 3),
+        sensor_filter_decimate_init(&decimate, 4),
+    };
+    sensor_filter_stage_t *chain = sensor_filter_chain(stages, 4);
+    CHECK(chain == &outlier.stage);
+    CHECK(outlier.stage.next == &median.stage && median.stage.next == &ema.stage);
+    CHECK(ema.stage.next == &decimate.stage && decimate.stage.next == NULL);
+
+    for (int round = 0; round < 2; round++) {
+        sensor_filter_outlier_t outlier_alone;
+        sensor_filter_outlier_init(&outlier_alone, 200, 3);
+        sensor_filter_median_init(&median_alone, 5);
+        sensor_filter_ema_init(&ema_alone, 3);
+        sensor_filter_decimate_init(&decimate_alone, 4);
+
+        srand(7);
+        int emitted = 0;
+        for (int i = 0; i < 1000; i++) {
+            int32_t in = i % 37 == 0 ? 100000 : noisy(i < 500 ? 2000 : 3000, 50);
+            int32_t a, b, c, expected;
+            bool through = outlier_alone.stage.ops->process(&outlier_alone.stage, in, &a) &&
+                           median_alone.stage.ops->process(&median_alone.stage, a, &b) &&
+                           ema_alone.stage.ops->process(&ema_alone.stage, b, &c) &&
+                           decimate_alone.stage.ops->process(&decimate_alone.stage, c, &expected);
+            bool got = sensor_filter_run(chain, in, &out);
+            CHECK_EQ(got, through);
+            if (got && through) {
+                CHECK_EQ(out, expected);
+                emitted++;
+            }
+        }
+        CHECK(emitted > 200);
+        CHECK(out > 2900 && out < 3100);  // followed the step at sample 500, no spike got through
+
+        // a reset of the chain resets every stage, the second round sees the same output
+        sensor_filter_reset(chain);
+        CHECK_EQ(median.count, 0);
+        CHECK(!ema.primed);
+        CHECK_EQ(decimate.count, 0);
+        CHECK(!outlier.primed);
+    }
+}
+
+int main(void) {
+    test_mavg();
+    test_median();
+    test_ema();
+    test_outlier();
+    test_decimate();
+    test_chain();
+    return CHECK_RESULT();
+}
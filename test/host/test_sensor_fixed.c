@@ -0,0 +1,93 @@
+/**
+ * The integer sensor conversions (sensor_fixed.h) against the float formulas they
+ * replaced, rounded half up, for every 12-bit ADC code: die temperature in
+ * centi-degrees, millivolts, and VSYS millivolts through its divider of 3.
+ * Oversampled values are checked against value * 103125 / 2^extra_bits rounded to
+ * the nearest Q7 microvolt, for every value with up to 6 extra bits.
+ *
+ * The formulas are evaluated in double in an order that keeps the voltages exact
+ * (an ADC count is 3300000 / 4096 uV, a power of two fraction): odd multiples of 512
+ * sit exactly on half a millivolt, and 0.4125 * 1000 in double would round down.
+ */
+
+#include <math.h>
+
+#include "check.h"
+#include "sensor_fixed.h"
+
+#define ADC_CODES (1 << SENSOR_FIXED_ADC_BITS)
+#define VSYS_DIVIDER 3
+
+static double code_to_mv(double code) {
+    return code * SENSOR_FIXED_ADC_VREF_MV / ADC_CODES;
+}
+
+static int32_t round_half_up(double x) {
+    return (int32_t)floor(x + 0.5);
+}
+
+// 100 * (27 - (V - 0.706) / 0.001721), taking the voltage in millivolts
+static int32_t float_die_temp_centi_c(double mv) {
+    return round_half_up(2700.0 - (mv * 1000.0 - SENSOR_FIXED_DIE_V27_UV) * 100.0 / SENSOR_FIXED_DIE_SLOPE_UV);
+}
+
+static void test_every_code(void) {
+    int failures = 0;
+
+    for (uint16_t code = 0; code < ADC_CODES; code++) {
+        int32_t uv_q7 = sensor_fixed_adc_to_uv_q7(code);
+        double mv_float = code_to_mv(code);
+        CHECK_EQ(uv_q7, (int64_t)code * 3300000 * 128 / ADC_CODES);
+
+        int32_t temp = sensor_fixed_die_temp_centi_c(uv_q7);
+        int32_t mv = sensor_fixed_uv_q7_to_mv(uv_q7);
+        int32_t vsys = sensor_fixed_uv_q7_to_mv(uv_q7 * VSYS_DIVIDER);
+        if (temp != float_die_temp_centi_c(mv_float) || mv != round_half_up(mv_float) ||
+            vsys != round_half_up(mv_float * VSYS_DIVIDER)) {
+            if (failures++ < 10) {
+                fprintf(stderr, "code %u: %ld centi-C %ld mV %ld mV VSYS, float gives %ld %ld %ld\n", code,
+                        (long)temp, (long)mv, (long)vsys, (long)float_die_temp_centi_c(mv_float),
+                        (long)round_half_up(mv_float), (long)round_half_up(mv_float * VSYS_DIVIDER));
+            }
+        }
+    }
+    CHECK_EQ(failures, 0);
+}
+
+static void test_oversampled(void) {
+    for (uint8_t extra_bits = 0; extra_bits <= 6; extra_bits++) {
+        int failures = 0;
+        uint32_t values = (uint32_t)ADC_CODES << extra_bits;
+        for (uint32_t value = 0; value < values; value++) {
+            int64_t exact2 = ((int64_t)value * SENSOR_FIXED_UV_Q7_PER_COUNT * 2) >> extra_bits;  // twice, floored
+            int32_t expected = (int32_t)((exact2 + 1) / 2);
+            int32_t uv_q7 = sensor_fixed_adc_oversampled_to_uv_q7(value, extra_bits);
+            if (uv_q7 != expected && failures++ < 5) {
+                fprintf(stderr, "%u with %u extra bits: %ld uV Q7, expected %ld\n", value, extra_bits, (long)uv_q7,
+                        (long)expected);
+            }
+        }
+        CHECK_EQ(failures, 0);
+    }
+
+    // the top of the 15 extra bits the fraction can take without overflowing
+    uint32_t top = ((uint32_t)ADC_CODES << 15) - 1;
+    CHECK_EQ(sensor_fixed_adc_oversampled_to_uv_q7(top, 15),
+             ((int64_t)top * SENSOR_FIXED_UV_Q7_PER_COUNT + (1 << 14)) >> 15);
+}
+
+static void test_div_round(void) {
+    CHECK_EQ(sensor_fixed_div_round(15, 10), 2);
+    CHECK_EQ(sensor_fixed_div_round(14, 10), 1);
+    CHECK_EQ(sensor_fixed_div_round(-15, 10), -1);  // halves go up
+    CHECK_EQ(sensor_fixed_div_round(-16, 10), -2);
+    CHECK_EQ(sensor_fixed_div_round(-4, 10), 0);
+    CHECK_EQ(sensor_fixed_div_round(0, 7), 0);
+}
+
+int main(void) {
+    test_div_round();
+    test_every_code();
+    test_oversampled();
+    return CHECK_RESULT();
+}
@@ -0,0 +1,264 @@
+/**
+ * sensor_service scheduling and snapshots, with stand-in drivers as the
+ * registry. The shim cannot create the service task, so the test runs its passes
+ * (service_pass) by hand on a stopped clock.
+ *
+ * Rate: requests every millisecond for 10 s start 5 measurements of a part with
+ * a 2 s min_period_ms, one without requests starts every period_ms. A
+ * measurement still pending after timeout_ms fails with SENSOR_ERR_TIMEOUT; a
+ * failed, refused or out of range measurement counts as an error and keeps the
+ * last good values; a sensor whose init failed is never started. Snapshots:
+ * readers on 3 threads copy them while the service publishes, none is torn.
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "../../local-libs/sensor_service/sensor_service.c"
+#include "check.h"
+
+#define FAKES 4
+#define MIN_PERIOD_MS 2000
+#define PERIOD_MS 5000
+#define TIMEOUT_MS 100
+
+typedef struct {
+    sensor_status_t init_status;
+    sensor_status_t start_status;
+    sensor_status_t poll_status;  // < what every poll of a started measurement gives
+    int32_t values[2];
+    uint32_t starts;
+    uint32_t reads;
+} fake_t;
+
+static fake_t fakes[FAKES];
+
+static sensor_status_t fake_init(void *ctx) {
+    fake_t *fake = ctx;
+    return fake->init_status;
+}
+
+static sensor_status_t fake_start(void *ctx) {
+    fake_t *fake = ctx;
+    fake->starts++;
+    return fake->start_status;
+}
+
+static sensor_status_t fake_poll(void *ctx) {
+    fake_t *fake = ctx;
+    return fake->poll_status;
+}
+
+static sensor_status_t fake_read(void *ctx, int32_t *values, uint64_t *time_us) {
+    fake_t *fake = ctx;
+    fake->reads++;
+    values[0] = fake->values[0];
+    values[1] = fake->values[1];
+    *time_us = 0;  // the service stamps it
+    return SENSOR_OK;
+}
+
+#define FAKE_ENTRY(n)                                                                                   \
+    {                                                                                                   \
+        .name = "fake" #n, .values = 2,                                                                 \
+        .value = {{.name = "a", .unit = SENSOR_UNIT_MV, .min = -1000, .max = 1000},                     \
+                  {.name = "b", .unit = SENSOR_UNIT_MV, .min = -1000, .max = 1000}},                    \
+        .min_period_ms = MIN_PERIOD_MS, .period_ms = PERIOD_MS, .timeout_ms = TIMEOUT_MS,               \
+        .init = fake_init, .start = fake_start, .poll = fake_poll, .read = fake_read, .ctx = &fakes[n], \
+    }
+
+static const sensor_driver_t fake_drivers[FAKES] = {FAKE_ENTRY(0), FAKE_ENTRY(1), FAKE_ENTRY(2), FAKE_ENTRY(3)};
+
+const sensor_driver_t *const sensor_registry[] = {&fake_drivers[0], &fake_drivers[1], &fake_drivers[2],
+                                                  &fake_drivers[3]};
+const uint8_t sensor_registry_count = FAKES;
+
+static void advance_ms(uint32_t ms) {
+    shim_time_offset_us += (uint64_t)ms * 1000;
+}
+
+// Fakes that measure 12, -34 at once, and the service set up over them
+static void setup(void) {
+    for (uint8_t i = 0; i < FAKES; i++) {
+        fakes[i] = (fake_t){.init_status = SENSOR_OK, .start_status = SENSOR_OK, .poll_status = SENSOR_OK,
+                            .values = {12, -34}};
+    }
+    advance_ms(60000);  // well past anything an earlier test started
+    CHECK(!sensor_service_start(1));  // the task cannot be created here, but the sensors are set up
+}
+
+static sensor_snapshot_t snapshot_of(uint8_t sensor) {
+    sensor_snapshot_t snapshot;
+    sensor_service_read(sensor, &snapshot);
+    return snapshot;
+}
+
+static void test_rate(void) {
+    setup();
+    for (uint32_t ms = 0; ms < 10000; ms++) {
+        sensor_service_request(0);  // as fast as anyone could ask
+        service_pass();
+        advance_ms(1);
+    }
+    CHECK_EQ(fakes[0].starts, 10000 / MIN_PERIOD_MS);
+    CHECK_EQ(fakes[1].starts, 10000 / PERIOD_MS);  // nobody asked
+    CHECK_EQ(snapshot_of(0).samples, 10000 / MIN_PERIOD_MS);
+    CHECK_EQ(snapshot_of(0).errors, 0);
+
+    // requests made before the part allows merge into one measurement
+    setup();
+    service_pass();
+    for (int i = 0; i < 100; i++) {
+        sensor_service_request(0);
+        advance_ms(10);
+        service_pass();
+    }
+    CHECK_EQ(fakes[0].starts, 1);
+    advance_ms(MIN_PERIOD_MS - 1000);
+    service_pass();
+    service_pass();
+    CHECK_EQ(fakes[0].starts, 2);
+    CHECK_EQ(fakes[1].starts, 1);
+}
+
+static void test_timeout(void) {
+    setup();
+    fakes[0].poll_status = SENSOR_PENDING;
+    service_pass();
+    CHECK_EQ(fakes[0].starts, 1);
+    CHECK(sensors[0].busy);
+
+    advance_ms(TIMEOUT_MS - 1);
+    CHECK(service_pass() <= time_us_64() + ms_to_us(SENSOR_SERVICE_POLL_MS));  // does not sleep through it
+    CHECK(sensors[0].busy);
+    CHECK_EQ(snapshot_of(0).errors, 0);
+
+    advance_ms(1);
+    service_pass();
+    CHECK(!sensors[0].busy);
+    CHECK_EQ(fakes[0].reads, 0);
+    CHECK_EQ(snapshot_of(0).errors, 1);
+    CHECK_EQ(snapshot_of(0).last_error, SENSOR_ERR_TIMEOUT);
+    CHECK_EQ(fakes[0].starts, 1);  // and is not retried before its period
+}
+
+static void test_errors(void) {
+    setup();
+    fakes[0].poll_status = SENSOR_ERR_CRC;    // the driver reports a failure
+    fakes[1].start_status = SENSOR_ERR_BUSY;  // refuses to start
+    fakes[2].values[0] = 1001;                // out of range
+    fakes[3].init_status = SENSOR_ERR_INIT;
+    CHECK(!sensor_service_start(1));  // set up again, with the failing init
+    service_pass();
+
+    sensor_snapshot_t s;
+    CHECK(!sensor_service_read(0, &s));
+    CHECK_EQ(s.errors, 1);
+    CHECK_EQ(s.last_error, SENSOR_ERR_CRC);
+    CHECK_EQ(fakes[0].reads, 0);
+
+    CHECK(!sensor_service_read(1, &s));
+    CHECK_EQ(s.last_error, SENSOR_ERR_BUSY);
+    CHECK(!sensors[1].busy);  // nothing to collect
+
+    CHECK(!sensor_service_read(2, &s));
+    CHECK_EQ(s.errors, 1);
+    CHECK_EQ(s.last_error, SENSOR_ERR_RANGE);
+
+    CHECK(!sensor_service_read(3, &s));
+    CHECK_EQ(s.errors, 1);
+    CHECK_EQ(s.last_error, SENSOR_ERR_INIT);
+    CHECK_EQ(fakes[3].starts, 0);
+
+    // refused starts are not retried any faster than measurements
+    sensor_service_request(1);
+    advance_ms(MIN_PERIOD_MS - 1);
+    service_pass();
+    CHECK_EQ(fakes[1].starts, 1);
+    advance_ms(1);
+    service_pass();
+    CHECK_EQ(fakes[1].starts, 2);
+
+    // a good measurement, then a failure keeps its values
+    fakes[0].poll_status = SENSOR_OK;
+    sensor_service_request(0);
+    service_pass();
+    CHECK(sensor_service_read(0, &s));
+    CHECK_EQ(s.samples, 1);
+    CHECK_EQ(s.value[0], 12);
+    CHECK_EQ(s.value[1], -34);
+    CHECK_EQ(s.time_us, time_us_64());
+
+    fakes[0].poll_status = SENSOR_ERR_BUS;
+    sensor_service_request(0);
+    advance_ms(MIN_PERIOD_MS);
+    service_pass();
+    CHECK(sensor_service_read(0, &s));
+    CHECK_EQ(s.samples, 1);
+    CHECK_EQ(s.errors, 2);
+    CHECK_EQ(s.last_error, SENSOR_ERR_BUS);
+    CHECK_EQ(s.value[0], 12);
+
+    // and past the registry there is nothing
+    s.samples = 7;
+    CHECK(!sensor_service_read(FAKES, &s));
+    CHECK_EQ(s.samples, 0);
+}
+
+#define READERS 3
+#define WRITES 2000000
+
+static atomic_bool writing;
+static atomic_ulong torn;
+static atomic_ulong reads;
+
+// value[1] is always -value[0], time_us and samples move with it
+static void *reader(void *arg) {
+    unsigned long count = 0, bad = 0;
+    while (atomic_load(&writing)) {
+        sensor_snapshot_t s;
+        sensor_service_read(0, &s);
+        if (s.value[1] != -s.value[0] || s.time_us != (uint64_t)s.value[0] + 1 ||
+            s.samples != (uint32_t)s.value[0]) {
+            bad++;
+        }
+        count++;
+    }
+    atomic_fetch_add(&torn, bad);
+    atomic_fetch_add(&reads, count);
+    return NULL;
+}
+
+static void test_seqlock(void) {
+    setup();
+    int32_t first[2] = {1, -1};
+    publish(0, SENSOR_OK, first, 2);
+    atomic_store(&writing, true);
+    pthread_t threads[READERS];
+    for (int i = 0; i < READERS; i++) {
+        pthread_create(&threads[i], NULL, reader, NULL);
+    }
+
+    for (int32_t n = 2; n <= WRITES; n++) {
+        int32_t values[2] = {n, -n};
+        publish(0, SENSOR_OK, values, (uint64_t)n + 1);
+    }
+    atomic_store(&writing, false);
+    for (int i = 0; i < READERS; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    printf("seqlock: %lu reads against %d writes, %lu torn\n", atomic_load(&reads), WRITES, atomic_load(&torn));
+    CHECK(atomic_load(&reads) > 0);
+    CHECK_EQ(atomic_load(&torn), 0);
+    CHECK_EQ(snapshot_of(0).samples, WRITES);
+}
+
+int main(void) {
+    shim_time_stopped = true;
+    test_rate();
+    test_timeout();
+    test_errors();
+    test_seqlock();
+    return CHECK_RESULT();
+}
@@ -0,0 +1,188 @@
+/**
+ * Bytes the ssd1306 driver puts on the bus, captured from the i2c_bus host
+ * transport: one transaction for the whole init sequence, a 6 command window
+ * transaction in front of each 0x40 data transaction, and nothing sent into a
+ * window that did not get through.
+ */
+
+#include <string.h>
+
+#include "check.h"
+#include "i2c_bus_host.h"
+#include "ssd1306.h"
+
+#define ADDRESS 0x3C
+#define MAX_XFERS 16
+
+typedef struct {
+    uint8_t bytes[MAX_XFERS][1100];
+    size_t len[MAX_XFERS];
+    int count;
+    int fail_at;  // < transaction number that is not acknowledged, -1 for none
+} capture_t;
+
+static int capture_device(void *user, i2c_bus_xfer_t *xfer) {
+    capture_t *c = user;
+    int n = c->count++;
+    if (n == c->fail_at) {
+        return PICO_ERROR_GENERIC;
+    }
+    if (n < MAX_XFERS && xfer->tx_len <= sizeof(c->bytes[0])) {
+        memcpy(c->bytes[n], xfer->tx, xfer->tx_len);
+        c->len[n] = xfer->tx_len;
+    }
+    return (int)xfer->tx_len;
+}
+
+static capture_t cap;
+static i2c_bus_t bus;
+static i2c_bus_host_t host;
+
+static void reset_capture(void) {
+    memset(&cap, 0, sizeof(cap));
+    cap.fail_at = -1;
+}
+
+static void setup(ssd1306_t *disp, uint16_t width, uint16_t height) {
+    reset_capture();
+    i2c_bus_host_init(&bus, &host, capture_device, &cap, false);
+    disp->external_vcc = false;
+    CHECK(ssd1306_init_with_bus(disp, width, height, ADDRESS, &bus));
+}
+
+static void check_window(int n, uint8_t x0, uint8_t x1, uint8_t page0, uint8_t page1) {
+    const uint8_t expected[] = {0x00, SET_COL_ADDR, x0, x1, SET_PAGE_ADDR, page0, page1};
+    CHECK_EQ(cap.len[n], sizeof(expected));
+    CHECK(memcmp(cap.bytes[n], expected, sizeof(expected)) == 0);
+}
+
+static void test_init(void) {
+    ssd1306_t disp;
+    setup(&disp, 128, 64);
+
+    const uint8_t expected[] = {0x00, SET_DISP, SET_DISP_CLK_DIV, 0x80, SET_MUX_RATIO, 63, SET_DISP_OFFSET, 0x00,
+                                SET_DISP_START_LINE, SET_CHARGE_PUMP, 0x14, SET_SEG_REMAP | 0x01,
+                                SET_COM_OUT_DIR | 0x08, SET_COM_PIN_CFG, 0x12, SET_CONTRAST, 0xFF, SET_PRECHARGE, 0xF1,
+                                SET_VCOM_DESEL, 0x30, SET_ENTIRE_ON, SET_NORM_INV, SET_DISP | 0x01, SET_MEM_ADDR, 0x00};
+    CHECK_EQ(sizeof(expected), 1 + 25);
+    CHECK_EQ(cap.count, 1);
+    CHECK_EQ(cap.len[0], sizeof(expected));
+    CHECK(memcmp(cap.bytes[0], expected, sizeof(expected)) == 0);
+
+    ssd1306_deinit(&disp);
+}
+
+static void test_show(void) {
+    ssd1306_t disp;
+    setup(&disp, 128, 64);
+
+    // The first show pushes the whole buffer behind one window
+    reset_capture();
+    ssd1306_clear(&disp);
+    ssd1306_draw_pixel(&disp, 0, 0);
+    ssd1306_show(&disp);
+    CHECK_EQ(cap.count, 2);
+    check_window(0, 0, 127, 0, 7);
+    CHECK_EQ(cap.len[1], 1 + 1024);
+    CHECK_EQ(cap.bytes[1][0], 0x40);
+    CHECK_EQ(cap.bytes[1][1], 0x01);
+    CHECK_EQ(disp.stats.last_bytes, (1 + 7) + (1 + 1 + 1024));
+
+    // Later ones send a window and its data per damaged page
+    reset_capture();
+    ssd1306_draw_pixel(&disp, 10, 20);
+    ssd1306_draw_hline(&disp, 100, 63, 5);
+    ssd1306_show(&disp);
+    CHECK_EQ(cap.count, 4);
+    check_window(0, 10, 10, 2, 2);
+    CHECK_EQ(cap.len[1], 2);
+    CHECK_EQ(cap.bytes[1][0], 0x40);
+    CHECK_EQ(cap.bytes[1][1], 1 << 4);
+    check_window(2, 100, 104, 7, 7);
+    CHECK_EQ(cap.len[3], 1 + 5);
+    CHECK_EQ(cap.bytes[3][0], 0x40);
+    CHECK_EQ(cap.bytes[3][5], 0x80);
+
+    // Nothing changed, nothing sent
+    reset_capture();
+    ssd1306_draw_pixel(&disp, 10, 20);
+    ssd1306_show(&disp);
+    CHECK_EQ(cap.count, 0);
+
+    ssd1306_deinit(&disp);
+}
+
+static void test_narrow_panel(void) {
+    ssd1306_t disp;
+    setup(&disp, 64, 32);
+    CHECK_EQ(cap.bytes[0][5], 31);  // mux ratio
+    CHECK_EQ(cap.bytes[0][14], 0x12);  // COM pins for a panel not wider than twice its height
+
+    // Columns of 64 pixel wide panels start at 32
+    reset_capture();
+    ssd1306_show(&disp);
+    check_window(0, 32, 95, 0, 3);
+    CHECK_EQ(cap.len[1], 1 + 256);
+
+    ssd1306_deinit(&disp);
+}
+
+static void test_commands(void) {
+    ssd1306_t disp;
+    setup(&disp, 128, 32);
+
+    reset_capture();
+    ssd1306_contrast(&disp, 0x42);
+    ssd1306_invert(&disp, 1);
+    CHECK_EQ(cap.count, 2);
+    CHECK_EQ(cap.len[0], 3);
+    CHECK(memcmp(cap.bytes[0], (const uint8_t[]){0x00, SET_CONTRAST, 0x42}, 3) == 0);
+    CHECK_EQ(cap.len[1], 2);
+    CHECK(memcmp(cap.bytes[1], (const uint8_t[]){0x00, SET_NORM_INV | 1}, 2) == 0);
+
+    // Long command lists are split behind a fresh control byte every 32 commands
+    uint8_t cmds[40];
+    for (size_t i = 0; i < sizeof(cmds); i++) {
+        cmds[i] = SET_ENTIRE_ON;
+    }
+    reset_capture();
+    CHECK_EQ(ssd1306_write_commands(&disp, cmds, sizeof(cmds)), (1 + 1 + 32) + (1 + 1 + 8));
+    CHECK_EQ(cap.count, 2);
+    CHECK_EQ(cap.len[0], 1 + 32);
+    CHECK_EQ(cap.len[1], 1 + 8);
+    CHECK_EQ(cap.bytes[1][0], 0x00);
+
+    ssd1306_deinit(&disp);
+}
+
+static void test_failed_window(void) {
+    ssd1306_t disp;
+    setup(&disp, 128, 64);
+    ssd1306_show(&disp);
+
+    // The window is not acknowledged: its data must not be sent anywhere
+    reset_capture();
+    cap.fail_at = 0;
+    ssd1306_draw_pixel(&disp, 5, 5);
+    ssd1306_show(&disp);
+    CHECK_EQ(cap.count, 1);
+    CHECK(!disp.shadow_valid);
+
+    // So the next show cannot trust the shadow and pushes everything
+    reset_capture();
+    ssd1306_show(&disp);
+    CHECK_EQ(cap.count, 2);
+    check_window(0, 0, 127, 0, 7);
+    CHECK_EQ(cap.len[1], 1 + 1024);
+
+    ssd1306_deinit(&disp);
+}
+
+int main(void) {
+    test_init();
+    test_show();
+    test_narrow_panel();
+    test_commands();
+    test_failed_window();
+    return CHECK_RESULT();
+}
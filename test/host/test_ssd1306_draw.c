@@ -0,0 +1,393 @@
+/**
+ * The ssd1306 drawing fast paths against the per-pixel reference
+ * (ssd1306_reference.h): the result has to be identical pixel for pixel, on a
+ * random background so clearing and toggling show, and every byte that changed
+ * has to be inside the damaged span of its page or ssd1306_show would skip it.
+ *
+ * Clipped lines have no single right answer (where a clipped end lands depends on
+ * rounding), so they are checked for what a line must be: one pixel per step
+ * along its major axis, within a pixel of the ideal line, without gaps, its
+ * visible end points lit and nothing at all when it misses the panel.
+ *
+ * Text goes through the column blit at scale 1 and through the pre-expanded fonts
+ * at larger scales, both are compared with the per-pixel glyph drawing at every
+ * y offset within a page, including glyphs cut off at the right and bottom edge.
+ * All scaled fonts are built in here so each table is checked.
+ *
+ * ssd1306.c is included to reach its static rectangle fill.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#define SSD1306_FONT_SCALE_3 1
+#define SSD1306_FONT_SCALE_4 1
+#include "../../local-libs/ssd1306/ssd1306.c"
+#include "check.h"
+#include "ssd1306_reference.h"
+
+#define MODES 3
+
+static const char *mode_names[MODES] = {"set", "clear", "xor"};
+
+static ssd1306_t disp;
+static ssd1306_t ref;
+static uint8_t background[8 * 128];
+
+static void new_display(ssd1306_t *p, uint8_t width, uint8_t height) {
+    memset(p, 0, sizeof(*p));
+    p->width = width;
+    p->height = height;
+    p->pages = height / 8;
+    p->bufsize = p->pages * p->width;
+    p->buffer = malloc(p->bufsize);
+}
+
+static void setup(uint8_t width, uint8_t height) {
+    free(disp.buffer);
+    free(ref.buffer);
+    new_display(&disp, width, height);
+    new_display(&ref, width, height);
+    srand(width * height);
+    for (size_t i = 0; i < sizeof(background); i++) {
+        background[i] = (uint8_t)rand();
+    }
+}
+
+// Both buffers start from the random background with nothing damaged
+static void start(void) {
+    memcpy(disp.buffer, background, disp.bufsize);
+    memcpy(ref.buffer, background, ref.bufsize);
+    ssd1306_mark_clean(&disp);
+}
+
+// Returns false (and reports what) on the first difference
+static bool same_as_reference(const char *what) {
+    for (uint32_t i = 0; i < disp.bufsize; i++) {
+        if (disp.buffer[i] != ref.buffer[i]) {
+            fprintf(stderr, "%dx%d %s: column %u page %u is %02x, expected %02x\n", disp.width, disp.height, what,
+                    i % disp.width, i / disp.width, disp.buffer[i], ref.buffer[i]);
+            return false;
+        }
+        uint32_t page = i / disp.width, col = i % disp.width;
+        if (disp.buffer[i] != background[i] && (col < disp.dirty_x0[page] || col > disp.dirty_x1[page])) {
+            fprintf(stderr, "%dx%d %s: column %u page %u changed outside its damaged span %u-%u\n", disp.width,
+                    disp.height, what, col, page, disp.dirty_x0[page], disp.dirty_x1[page]);
+            return false;
+        }
+    }
+    return true;
+}
+
+static void test_fill_rect(void) {
+    // Edges on every bit of a page and across page boundaries, partly or wholly off the panel
+    static const int32_t xs[] = {-200, -3, 0, 1, 60, 126, 127, 128};
+    static const int32_t widths[] = {0, 1, 2, 5, 64, 130, 400};
+
+    for (int mode = 0; mode < MODES; mode++) {
+        for (int32_t y = -10; y <= disp.height + 2; y++) {
+            for (int32_t height = -1; height <= 20; height++) {
+                for (size_t xi = 0; xi < sizeof(xs) / sizeof(xs[0]); xi++) {
+                    for (size_t wi = 0; wi < sizeof(widths) / sizeof(widths[0]); wi++) {
+                        start();
+                        ssd1306_fill_rect(&disp, xs[xi], y, widths[wi], height, mode);
+                        ref_fill_rect(&ref, xs[xi], y, widths[wi], height, mode);
+
+                        char what[80];
+                        snprintf(what, sizeof(what), "fill_rect(%d, %d, %d, %d, %s)", xs[xi], y, widths[wi], height,
+                                 mode_names[mode]);
+                        if (!same_as_reference(what)) {
+                            check_failures++;
+                            return;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // A whole panel and more
+    start();
+    ssd1306_fill_rect(&disp, -5, -5, INT32_MAX, INT32_MAX, SSD1306_DRAW_XOR);
+    ref_fill_rect(&ref, 0, 0, disp.width, disp.height, SSD1306_DRAW_XOR);
+    CHECK(same_as_reference("fill_rect(whole panel)"));
+}
+
+static void test_lines_and_squares(void) {
+    static const int32_t starts[] = {-1000, -1, 0, 3, 7, 8, 30, 62, 63, 64, 127, 200};
+    static const uint32_t lengths[] = {0, 1, 2, 8, 9, 57, 64, 128, 129, UINT32_MAX};
+
+    for (size_t a = 0; a < sizeof(starts) / sizeof(starts[0]); a++) {
+        for (size_t b = 0; b < sizeof(starts) / sizeof(starts[0]); b++) {
+            for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+                int32_t x = starts[a], y = starts[b];
+                uint32_t len = lengths[l];
+                char what[80];
+
+                start();
+                ssd1306_draw_hline(&disp, x, y, len);
+                ref_fill_rect(&ref, x, y, len, 1, SSD1306_DRAW_SET);
+                snprintf(what, sizeof(what), "draw_hline(%d, %d, %u)", x, y, len);
+                CHECK(same_as_reference(what));
+
+                start();
+                ssd1306_draw_vline(&disp, x, y, len);
+                ref_fill_rect(&ref, x, y, 1, len, SSD1306_DRAW_SET);
+                snprintf(what, sizeof(what), "draw_vline(%d, %d, %u)", x, y, len);
+                CHECK(same_as_reference(what));
+
+                // Squares take unsigned positions, negative ones are far off the panel
+                start();
+                ssd1306_draw_square(&disp, x, y, len, len / 2);
+                if (x >= 0 && y >= 0) {
+                    ref_fill_rect(&ref, x, y, len, len / 2, SSD1306_DRAW_SET);
+                }
+                snprintf(what, sizeof(what), "draw_square(%d, %d, %u, %u)", x, y, len, len / 2);
+                CHECK(same_as_reference(what));
+            }
+        }
+    }
+}
+
+static bool lit(int64_t x, int64_t y) {
+    return (disp.buffer[x + disp.width * (y >> 3)] >> (y & 7)) & 1;
+}
+
+static int lit_count(void) {
+    int count = 0;
+    for (uint32_t i = 0; i < disp.bufsize; i++) {
+        count += __builtin_popcount(disp.buffer[i]);
+    }
+    return count;
+}
+
+// Draws the line on a clear buffer and checks it, reports and returns false on the first problem
+static bool line_ok(int32_t x1, int32_t y1, int32_t x2, int32_t y2) {
+    memset(disp.buffer, 0, disp.bufsize);
+    ssd1306_mark_clean(&disp);
+    ssd1306_draw_line(&disp, x1, y1, x2, y2);
+
+    // Work along the major axis: a is the major coordinate, b the minor one
+    bool x_major = llabs((int64_t)x2 - x1) >= llabs((int64_t)y2 - y1);
+    int64_t a1 = x_major ? x1 : y1, b1 = x_major ? y1 : x1;
+    int64_t a2 = x_major ? x2 : y2, b2 = x_major ? y2 : x2;
+    int64_t da = a2 - a1, db = b2 - b1;
+    int64_t a_size = x_major ? disp.width : disp.height, b_size = x_major ? disp.height : disp.width;
+    int64_t a_lo = a1 < a2 ? a1 : a2, a_hi = a1 < a2 ? a2 : a1;
+    int64_t first = -1, last = -1;
+    const char *problem = NULL;
+    int64_t at = 0;
+
+    for (int64_t a = 0; a < a_size && problem == NULL; a++) {
+        int64_t found = -1;
+        for (int64_t b = 0; b < b_size; b++) {
+            if (!lit(x_major ? a : b, x_major ? b : a)) {
+                continue;
+            }
+            if (found >= 0) {
+                problem = "two pixels on one step";
+            }
+            found = b;
+        }
+        at = a;
+
+        // The ideal minor coordinate is ideal / da, kept exact in 128 bits
+        __int128 ideal = (__int128)b1 * da + (__int128)db * (a - a1);
+        __int128 span = da < 0 ? -(__int128)da : da;
+        if (da < 0) {
+            ideal = -ideal;
+        }
+
+        if (found < 0) {
+            // Missing is only fine where the line is (nearly) off the panel
+            if (a >= a_lo && a <= a_hi && ideal >= span && ideal <= (__int128)(b_size - 2) * span && first >= 0 &&
+                last == a - 1) {
+                problem = "gap";
+            }
+            if (a >= a_lo && a <= a_hi && ideal >= span && ideal <= (__int128)(b_size - 2) * span && first < 0 &&
+                a > a_lo + 1) {
+                problem = "missing start";
+            }
+            continue;
+        }
+
+        __int128 off = (__int128)found * span - ideal;
+        if (a < a_lo || a > a_hi || off > span || off < -span) {
+            problem = "pixel off the line";
+        }
+        if (first >= 0 && last != a - 1) {
+            problem = "gap";
+        }
+        if (first < 0) {
+            first = a;
+        }
+        last = a;
+
+        int64_t px = x_major ? a : found, py = x_major ? found : a;
+        if (px < disp.dirty_x0[py >> 3] || px > disp.dirty_x1[py >> 3]) {
+            problem = "pixel outside the damaged span";
+        }
+    }
+
+    if (problem == NULL && x1 >= 0 && x1 < disp.width && y1 >= 0 && y1 < disp.height && !lit(x1, y1)) {
+        problem = "start point not lit";
+    }
+    if (problem == NULL && x2 >= 0 && x2 < disp.width && y2 >= 0 && y2 < disp.height && !lit(x2, y2)) {
+        problem = "end point not lit";
+    }
+
+    if (problem != NULL) {
+        fprintf(stderr, "%dx%d draw_line(%d, %d, %d, %d): %s at %s %lld\n", disp.width, disp.height, x1, y1, x2, y2,
+                problem, x_major ? "x" : "y", (long long)at);
+        return false;
+    }
+    return true;
+}
+
+static void test_clipped_lines(void) {
+    int32_t w = disp.width, h = disp.height;
+
+    // Random lines, most of them leaving the panel on one side or both
+    srand(w + h);
+    for (int i = 0; i < 20000; i++) {
+        int32_t x1 = rand() % (w + 400) - 200, y1 = rand() % (h + 400) - 200;
+        int32_t x2 = rand() % (w + 400) - 200, y2 = rand() % (h + 400) - 200;
+        if (!line_ok(x1, y1, x2, y2)) {
+            check_failures++;
+            break;
+        }
+    }
+
+    // Wholly outside, including lines whose bounding box covers part of the panel
+    static const int32_t outside[][4] = {
+        {-50, -50, -1, -1}, {-20, 10, 10, -20}, {-5, -1, -1, -5}, {10, -1, 200, -300}, {-1, 0, -1, 1000},
+    };
+    for (size_t i = 0; i < sizeof(outside) / sizeof(outside[0]); i++) {
+        CHECK(line_ok(outside[i][0], outside[i][1], outside[i][2], outside[i][3]));
+        CHECK_EQ(lit_count(), 0);
+    }
+    CHECK(line_ok(w - 10, -20, w + 30, 20));  // passes right of the top right corner
+    CHECK_EQ(lit_count(), 0);
+    CHECK(line_ok(-30, h - 20, 0, h + 10));  // passes below the bottom left corner
+    CHECK_EQ(lit_count(), 0);
+
+    // Crossing a corner and nothing else
+    CHECK(line_ok(-10, 10, 10, -10));
+    CHECK_EQ(lit_count(), 1);
+    CHECK(lit(0, 0));
+    CHECK(line_ok(w - 11, -10, w + 9, 10));
+    CHECK_EQ(lit_count(), 1);
+    CHECK(lit(w - 1, 0));
+    CHECK(line_ok(w + 9, h + 9, w - 11, h - 11));
+    CHECK_EQ(lit_count(), 11);
+    CHECK(lit(w - 1, h - 1));
+
+    // Coordinates whose differences and products overflow 32 bits (the int64 path)
+    int32_t diagonal = w < h ? w : h;
+    CHECK(line_ok(INT32_MIN, INT32_MIN, INT32_MAX, INT32_MAX));
+    CHECK_EQ(lit_count(), diagonal);
+    for (int32_t i = 0; i < diagonal; i++) {
+        CHECK(lit(i, i));
+    }
+    CHECK(line_ok(INT32_MAX, INT32_MAX, INT32_MIN, INT32_MIN));
+    CHECK_EQ(lit_count(), diagonal);
+    CHECK(line_ok(INT32_MIN, INT32_MAX, INT32_MAX, INT32_MIN));
+    CHECK(line_ok(INT32_MIN, 1, INT32_MAX, h - 2));
+    CHECK_EQ(lit_count(), w);
+    CHECK(line_ok(1, INT32_MIN, w - 2, INT32_MAX));
+    CHECK_EQ(lit_count(), h);
+    CHECK(line_ok(INT32_MIN, INT32_MIN, INT32_MIN + 1, INT32_MAX));
+    CHECK_EQ(lit_count(), 0);
+    for (int i = 0; i < 2000; i++) {
+        int32_t x1 = (int32_t)((uint32_t)rand() * 2654435761u), y1 = (int32_t)((uint32_t)rand() * 2246822519u);
+        int32_t x2 = rand() % (w + 40) - 20, y2 = rand() % (h + 40) - 20;
+        if (!line_ok(x1, y1, x2, y2) || !line_ok(x2, y2, x1, y1)) {
+            check_failures++;
+            break;
+        }
+    }
+
+    // Axis aligned lines are clamped before their length is worked out
+    static const int32_t edges[] = {INT32_MIN, -1, 0, 5, 31, 47, 63, 64, 127, 128, INT32_MAX};
+    for (size_t e = 0; e < sizeof(edges) / sizeof(edges[0]); e++) {
+        for (int mode = 0; mode < MODES; mode++) {
+            int32_t at = edges[e];
+            char what[80];
+
+            start();
+            ssd1306_draw_line_with_mode(&disp, INT32_MAX, at, INT32_MIN, at, mode);
+            if (at >= 0 && at < h) {
+                ref_fill_rect(&ref, 0, at, w, 1, mode);
+            }
+            snprintf(what, sizeof(what), "draw_line(INT32_MAX, %d, INT32_MIN, %d, %s)", at, at, mode_names[mode]);
+            CHECK(same_as_reference(what));
+
+            start();
+            ssd1306_draw_line_with_mode(&disp, at, INT32_MIN, at, INT32_MAX, mode);
+            if (at >= 0 && at < w) {
+                ref_fill_rect(&ref, at, 0, 1, h, mode);
+            }
+            snprintf(what, sizeof(what), "draw_line(%d, INT32_MIN, %d, INT32_MAX, %s)", at, at, mode_names[mode]);
+            CHECK(same_as_reference(what));
+
+            start();
+            ssd1306_draw_line_with_mode(&disp, at, 3, -7, 3, mode);
+            if (at >= 0) {
+                ref_fill_rect(&ref, 0, 3, (int64_t)at + 1, 1, mode);
+            } else {
+                ref_fill_rect(&ref, at, 3, -7 - (int64_t)at + 1, 1, mode);
+            }
+            snprintf(what, sizeof(what), "draw_line(%d, 3, -7, 3, %s)", at, mode_names[mode]);
+            CHECK(same_as_reference(what));
+        }
+    }
+}
+
+static void test_text(void) {
+    char all[96];
+    for (int c = 0; c < 95; c++) {
+        all[c] = (char)(' ' + c);
+    }
+    all[95] = '\0';
+    // out of range characters draw nothing but still take their place
+    const char *strings[] = {all, "Temp 23.45C", "\x7f\x1f" "ab\x80" "c", "", "W"};
+    const int32_t xs[] = {0, 1, 3, 7, disp.width / 2 - 1, disp.width - 9, disp.width - 5, disp.width - 1,
+                          disp.width};
+    char what[96];
+
+    for (uint32_t scale = 1; scale <= 4; scale++) {
+        for (uint32_t y = 0; y < disp.height; y++) {
+            for (size_t xi = 0; xi < sizeof(xs) / sizeof(xs[0]); xi++) {
+                for (size_t si = 0; si < sizeof(strings) / sizeof(strings[0]); si++) {
+                    snprintf(what, sizeof(what), "draw_string scale %u at (%d,%u) string %zu", scale, xs[xi], y,
+                             si);
+                    start();
+                    ssd1306_draw_string(&disp, xs[xi], y, scale, strings[si]);
+                    ref_draw_string(&ref, xs[xi], y, scale, font_8x5, strings[si]);
+                    CHECK(same_as_reference(what));
+                }
+
+                for (int c = 0; c < 128; c += scale == 1 ? 1 : 7) {
+                    snprintf(what, sizeof(what), "draw_char scale %u at (%d,%u) char %d", scale, xs[xi], y, c);
+                    start();
+                    ssd1306_draw_char(&disp, xs[xi], y, scale, (char)c);
+                    ref_draw_char(&ref, xs[xi], y, scale, font_8x5, (char)c);
+                    CHECK(same_as_reference(what));
+                }
+            }
+        }
+    }
+}
+
+int main(void) {
+    static const uint8_t sizes[][2] = {{128, 64}, {128, 32}, {64, 48}};
+
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        setup(sizes[i][0], sizes[i][1]);
+        test_fill_rect();
+        test_lines_and_squares();
+        test_clipped_lines();
+        test_text();
+    }
+    return CHECK_RESULT();
+}
@@ -0,0 +1,144 @@
+/**
+ * Renders temperature screens laid out like write_temp_to_display
+ * (src/temp_display_queue.c) through the real driver, the i2c_bus host transport
+ * and the ssd1306 controller simulator, and compares the simulated panel with the
+ * golden images in golden/.
+ *
+ *   test_ssd1306_screens <golden dir>           compare
+ *   test_ssd1306_screens <golden dir> --update  rewrite the golden images (check them before committing)
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "check.h"
+#include "i2c_bus_host.h"
+#include "sensor_fixed.h"
+#include "ssd1306.h"
+#include "ssd1306_sim.h"
+#include "string_operations.h"
+
+#define ADDRESS 0x3C
+
+typedef struct {
+    int32_t temp;  // < centi-degrees C
+    int32_t voltage;  // < mV
+    int32_t vsys;  // < mV, -1 when unknown
+    bool has_ambient;
+    int32_t amb_temp;  // < deci-degrees C
+    int32_t amb_hum;   // < deci-percent
+} reading_t;
+
+static const char *golden_dir;
+static bool update;
+
+// Same layout and formatting as write_temp_to_display
+static void draw_screen(ssd1306_t *disp, const reading_t *reading) {
+    ssd1306_clear(disp);
+    ssd1306_draw_string(disp, 40, 4, 2, "PICO");
+
+    char line[20];
+    size_t len;
+    if (reading != NULL) {
+        static const uint8_t rows[] = {26, 38, 52};
+        static const uint8_t rows_ambient[] = {22, 32, 42, 52};
+        const uint8_t *row = reading->has_ambient ? rows_ambient : rows;
+
+        len = str_append(line, sizeof(line), 0, "Temp: ");
+        int n = fixed_to_str(sensor_fixed_div_round(reading->temp, 10), 1, line + len, sizeof(line) - len, 0, ' ');
+        len = str_append(line, sizeof(line), n < 0 ? len : len + n, " C");
+        ssd1306_draw_string(disp, 13, row[0], 1, line);
+
+        len = str_append(line, sizeof(line), 0, "RP: ");
+        n = fixed_to_str(sensor_fixed_div_round(reading->voltage, 10), 2, line + len, sizeof(line) - len, 0, ' ');
+        len = str_append(line, sizeof(line), n < 0 ? len : len + n, "V");
+        ssd1306_draw_string(disp, 13, row[1], 1, line);
+
+        if (reading->vsys >= 0) {
+            len = str_append(line, sizeof(line), 0, "VSYS: ");
+            n = fixed_to_str(sensor_fixed_div_round(reading->vsys, 10), 2, line + len, sizeof(line) - len, 0, ' ');
+            len = str_append(line, sizeof(line), n < 0 ? len : len + n, "V");
+            ssd1306_draw_string(disp, 13, row[2], 1, line);
+        } else {
+            ssd1306_draw_string(disp, 13, row[2], 1, "RP2040 PACKAGE");
+        }
+
+        if (reading->has_ambient) {
+            len = str_append(line, sizeof(line), 0, "AMB: ");
+            n = fixed_to_str(reading->amb_temp, 1, line + len, sizeof(line) - len, 0, ' ');
+            len = str_append(line, sizeof(line), n < 0 ? len : len + n, "C ");
+            n = fixed_to_str(reading->amb_hum, 1, line + len, sizeof(line) - len, 0, ' ');
+            len = str_append(line, sizeof(line), n < 0 ? len : len + n, "%");
+            ssd1306_draw_string(disp, 13, row[3], 1, line);
+        }
+    } else {
+        ssd1306_draw_string(disp, 13, 26, 1, "NIL");
+        ssd1306_draw_string(disp, 13, 38, 1, "NIL");
+        ssd1306_draw_string(disp, 13, 52, 1, "RP2040 PACKAGE");
+    }
+
+    ssd1306_show(disp);
+}
+
+static void check_golden(const ssd1306_sim_t *sim, const char *name) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s.pbm", golden_dir, name);
+
+    if (update) {
+        CHECK(ssd1306_sim_write_pbm(sim, path));
+        return;
+    }
+
+    long diff = ssd1306_sim_compare_pbm(sim, path);
+    if (diff != 0) {
+        // Leave the actual image next to the test binary for a look
+        char actual[512];
+        snprintf(actual, sizeof(actual), "%s.actual.pbm", name);
+        ssd1306_sim_write_pbm(sim, actual);
+        fprintf(stderr, "%s: %ld pixels differ (-1: unreadable), see %s\n", path, diff, actual);
+    }
+    CHECK_EQ(diff, 0);
+}
+
+static const reading_t package = {.temp = 2731, .voltage = 706, .vsys = -1};
+static const reading_t vsys = {.temp = 3148, .voltage = 699, .vsys = 4987};
+static const reading_t ambient = {
+    .temp = -1234, .voltage = 725, .vsys = 5012, .has_ambient = true, .amb_temp = -52, .amb_hum = 456};
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <golden dir> [--update]\n", argv[0]);
+        return 2;
+    }
+    golden_dir = argv[1];
+    update = argc > 2 && strcmp(argv[2], "--update") == 0;
+
+    ssd1306_sim_t sim;
+    i2c_bus_t bus;
+    i2c_bus_host_t host;
+    ssd1306_t disp;
+    ssd1306_sim_init(&sim, 128, 64, ADDRESS);
+    i2c_bus_host_init(&bus, &host, ssd1306_sim_i2c_device, &sim, false);
+    disp.external_vcc = false;
+    CHECK(ssd1306_init_with_bus(&disp, 128, 64, ADDRESS, &bus));
+
+    draw_screen(&disp, NULL);
+    check_golden(&sim, "screen_nil");
+    draw_screen(&disp, &package);
+    check_golden(&sim, "screen_package");
+    draw_screen(&disp, &vsys);
+    check_golden(&sim, "screen_vsys");
+    draw_screen(&disp, &ambient);
+    check_golden(&sim, "screen_ambient");
+
+    // Back to an earlier screen with damaged spans only: the panel has to end up the same
+    uint32_t full_pushes = disp.stats.full_pushes;
+    draw_screen(&disp, &vsys);
+    CHECK_EQ(disp.stats.full_pushes, full_pushes);
+    if (!update) {
+        check_golden(&sim, "screen_vsys");
+    }
+
+    ssd1306_deinit(&disp);
+    return CHECK_RESULT();
+}
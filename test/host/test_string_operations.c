@@ -0,0 +1,180 @@
+/**
+ * fixed_to_str and str_append (string_operations.h).
+ *
+ * fixed_to_str is compared with snprintf("%*.*f") of the same value as a double,
+ * which is exact for every int32 at up to 9 decimals, over edge values, random
+ * values, every width and both pads. Values between -1 and 0 keep their sign
+ * ("-0.05"), zero never gets one. A buffer one byte short of the result gives -1
+ * and an empty string, and nothing past size is written.
+ */
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "check.h"
+#include "string_operations.h"
+
+#define GUARD 0x5A
+
+static const double powers[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+
+// Formats value against snprintf, returns false (and reports) on a difference
+static bool same_as_printf(int32_t value, uint8_t decimals, uint8_t width, char pad) {
+    char expected[32], actual[32];
+    uint8_t shown = decimals > 9 ? 9 : decimals;
+    snprintf(expected, sizeof(expected), pad == '0' ? "%0*.*f" : "%*.*f", width, shown, value / powers[shown]);
+
+    int n = fixed_to_str(value, decimals, actual, sizeof(actual), width, pad);
+    if (n != (int)strlen(expected) || strcmp(actual, expected) != 0) {
+        fprintf(stderr, "fixed_to_str(%ld, %u, width %u, pad '%c') gave \"%s\" (%d), expected \"%s\"\n", (long)value,
+                decimals, width, pad, actual, n, expected);
+        return false;
+    }
+    return true;
+}
+
+static void test_against_printf(void) {
+    static const int32_t edges[] = {0, 1, -1, 5, -5, 9, -9, 10, -10, 99, -99, 100, -100, 12345, -12345,
+                                    999999, -999999, 1000000, 1000000000, -1000000000, INT32_MAX, INT32_MIN,
+                                    INT32_MIN + 1};
+
+    for (uint8_t decimals = 0; decimals <= 10; decimals++) {
+        for (size_t i = 0; i < sizeof(edges) / sizeof(edges[0]); i++) {
+            for (uint8_t width = 0; width <= 14; width++) {
+                CHECK(same_as_printf(edges[i], decimals, width, ' '));
+                CHECK(same_as_printf(edges[i], decimals, width, '0'));
+            }
+        }
+    }
+
+    srand(11);
+    for (int i = 0; i < 200000; i++) {
+        int32_t value = (int32_t)(((uint32_t)rand() << 16) ^ (uint32_t)rand());
+        if (i & 1) {
+            value %= 100000;  // the range the display shows
+        }
+        CHECK(same_as_printf(value, (uint8_t)(i % 4), (uint8_t)(i % 9), i & 2 ? '0' : ' '));
+    }
+}
+
+static void test_examples(void) {
+    char buf[16];
+
+    CHECK_EQ(fixed_to_str(-275, 1, buf, sizeof(buf), 0, ' '), 5);
+    CHECK(strcmp(buf, "-27.5") == 0);
+    CHECK_EQ(fixed_to_str(5, 2, buf, sizeof(buf), 0, ' '), 4);
+    CHECK(strcmp(buf, "0.05") == 0);
+
+    // negative values above -1 keep their sign, zero has none
+    CHECK_EQ(fixed_to_str(-5, 2, buf, sizeof(buf), 0, ' '), 5);
+    CHECK(strcmp(buf, "-0.05") == 0);
+    CHECK_EQ(fixed_to_str(-1, 9, buf, sizeof(buf), 0, ' '), 12);
+    CHECK(strcmp(buf, "-0.000000001") == 0);
+    CHECK_EQ(fixed_to_str(0, 1, buf, sizeof(buf), 0, ' '), 3);
+    CHECK(strcmp(buf, "0.0") == 0);
+    CHECK_EQ(fixed_to_str(0, 0, buf, sizeof(buf), 0, ' '), 1);
+    CHECK(strcmp(buf, "0") == 0);
+
+    // spaces go before the sign, zeros after it
+    CHECK_EQ(fixed_to_str(-42, 1, buf, sizeof(buf), 6, ' '), 6);
+    CHECK(strcmp(buf, "  -4.2") == 0);
+    CHECK_EQ(fixed_to_str(-42, 1, buf, sizeof(buf), 6, '0'), 6);
+    CHECK(strcmp(buf, "-004.2") == 0);
+    CHECK_EQ(fixed_to_str(42, 1, buf, sizeof(buf), 6, '0'), 6);
+    CHECK(strcmp(buf, "0004.2") == 0);
+
+    // a width below the length does not cut anything off
+    CHECK_EQ(fixed_to_str(12345, 2, buf, sizeof(buf), 3, ' '), 6);
+    CHECK(strcmp(buf, "123.45") == 0);
+}
+
+// fixed_to_str into size bytes of a guarded buffer
+static int format_into(char *buf, size_t size, int32_t value, uint8_t decimals, uint8_t width, char pad) {
+    memset(buf, GUARD, 32);
+    return fixed_to_str(value, decimals, buf, size, width, pad);
+}
+
+static bool untouched_from(const char *buf, size_t from) {
+    for (size_t i = from; i < 32; i++) {
+        if ((uint8_t)buf[i] != GUARD) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void test_small_buffers(void) {
+    char buf[32];
+
+    // "-27.5" needs 6 bytes with its terminator
+    CHECK_EQ(format_into(buf, 6, -275, 1, 0, ' '), 5);
+    CHECK(strcmp(buf, "-27.5") == 0);
+    CHECK(untouched_from(buf, 6));
+    CHECK_EQ(format_into(buf, 5, -275, 1, 0, ' '), -1);
+    CHECK_EQ(buf[0], '\0');
+    CHECK(untouched_from(buf, 1));
+    CHECK_EQ(format_into(buf, 1, -275, 1, 0, ' '), -1);
+    CHECK_EQ(buf[0], '\0');
+    CHECK(untouched_from(buf, 1));
+    CHECK_EQ(format_into(buf, 0, -275, 1, 0, ' '), -1);
+    CHECK(untouched_from(buf, 0));
+
+    // the padding counts as well
+    CHECK_EQ(format_into(buf, 8, 5, 1, 7, '0'), 7);
+    CHECK(strcmp(buf, "00000.5") == 0);
+    CHECK(untouched_from(buf, 8));
+    CHECK_EQ(format_into(buf, 7, 5, 1, 7, '0'), -1);
+    CHECK_EQ(buf[0], '\0');
+    CHECK(untouched_from(buf, 1));
+
+    // the longest result there is
+    CHECK_EQ(format_into(buf, 13, INT32_MIN, 9, 0, ' '), 12);
+    CHECK(strcmp(buf, "-2.147483648") == 0);
+    CHECK(untouched_from(buf, 13));
+    CHECK_EQ(format_into(buf, 12, INT32_MIN, 9, 0, ' '), -1);
+    CHECK(untouched_from(buf, 1));
+}
+
+static void test_str_append(void) {
+    char buf[8];
+    memset(buf, GUARD, sizeof(buf));
+
+    size_t len = str_append(buf, sizeof(buf), 0, "ab");
+    CHECK_EQ(len, 2);
+    CHECK(strcmp(buf, "ab") == 0);
+    len = str_append(buf, sizeof(buf), len, "");
+    CHECK_EQ(len, 2);
+    CHECK(strcmp(buf, "ab") == 0);
+
+    // truncated to size - 1 characters, always terminated
+    len = str_append(buf, sizeof(buf), len, "cdefghij");
+    CHECK_EQ(len, 7);
+    CHECK(strcmp(buf, "abcdefg") == 0);
+    len = str_append(buf, sizeof(buf), len, "x");
+    CHECK_EQ(len, 7);
+    CHECK(strcmp(buf, "abcdefg") == 0);
+
+    // nothing is written into a buffer of no size
+    char none = GUARD;
+    CHECK_EQ(str_append(&none, 0, 0, "abc"), 0);
+    CHECK_EQ((uint8_t)none, GUARD);
+
+    // appending after a fixed_to_str that did not fit keeps the line as it was
+    char line[12];
+    len = str_append(line, sizeof(line), 0, "Temp: ");
+    int n = fixed_to_str(-123456789, 1, line + len, sizeof(line) - len, 0, ' ');
+    CHECK_EQ(n, -1);
+    len = str_append(line, sizeof(line), n < 0 ? len : len + n, " C");
+    CHECK_EQ(len, 8);
+    CHECK(strcmp(line, "Temp:  C") == 0);
+}
+
+int main(void) {
+    test_examples();
+    test_against_printf();
+    test_small_buffers();
+    test_str_append();
+    return CHECK_RESULT();
+}